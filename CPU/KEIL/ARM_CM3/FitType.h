@@ -50,11 +50,15 @@ typedef unsigned short          uOS16_t;
 typedef signed short            sOS16_t;
 typedef unsigned int            uOS32_t;
 typedef signed int              sOS32_t;
+typedef unsigned long long      uOS64_t;
+typedef signed long long        sOS64_t;
 
 typedef uOS32_t                 uOSStack_t;
 typedef sOS32_t                 sOSBase_t;
 typedef uOS32_t                 uOSBase_t;
 typedef uOS32_t                 uOSTick_t;
+typedef sOS32_t                 sOSTick_t;      // as wide as uOSTick_t
+typedef unsigned long           uOSAddr_t;      // as wide as a pointer
 
 #define FITSTACK_GROWTH         ( -1 )
 #define FITBYTE_ALIGNMENT       ( 4 )
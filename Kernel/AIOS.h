@@ -47,7 +47,14 @@ extern "C" {
 #include "FitType.h"
 #include "OSType.h"
 #include "OSMemory.h"
-//#include "FitCPU.h"
+#include "OSMemArena.h"
+#include "OSStack.h"
+#include "OSTime.h"
+#include "OSWorkQ.h"
+#include "OSBuf.h"
+#include "OSCoroutine.h"
+#include "OSProfile.h"
+#include "FitCPU.h"
 //#include "OSList.h"
 //#include "OSTask.h"
 //#include "OSMsgQ.h"
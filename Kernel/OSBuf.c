@@ -0,0 +1,396 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#include "AIOS.h"
+#include "OSBuf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (OS_BUF_ON==1)
+
+#define SIZEOF_OSBUF_ALIGNED	OSMEM_ALIGN_SIZE(sizeof(tOSBuf_t))
+/** the first byte of the data area allocated together with a segment */
+#define OSBUF_DATA(ptBuf)		((uOS8_t *)(ptBuf) + SIZEOF_OSBUF_ALIGNED)
+
+/*****************************************************************************
+Function    : OSBufAlloc
+Description : Allocate a buffer of one segment from the heap, with room in front
+              of the payload for the headers to be pushed by OSBufHeaderPush().
+Input       : uxHeadroom -- bytes reserved in front of the payload.
+              uxLen -- bytes of the payload.
+Output      : None
+Return      : the buffer with a reference count of 1, or OS_NULL if there is no
+              enough memory.
+*****************************************************************************/
+tOSBuf_t *OSBufAlloc(uOSMemSize_t uxHeadroom, uOSMemSize_t uxLen)
+{
+	tOSBuf_t *ptBuf;
+	uOS32_t uxSize;
+
+	uxSize = (uOS32_t)SIZEOF_OSBUF_ALIGNED + uxHeadroom + uxLen;
+	if ((uOS32_t)(uOSMemSize_t)uxSize != uxSize)
+	{
+		return OS_NULL;
+	}
+
+	ptBuf = (tOSBuf_t *)OSMemMalloc((uOSMemSize_t)uxSize);
+	if (ptBuf != OS_NULL)
+	{
+		ptBuf->ptNext = OS_NULL;
+		ptBuf->ptOwner = OS_NULL;
+		ptBuf->puxPayload = OSBUF_DATA(ptBuf) + uxHeadroom;
+		ptBuf->uxLen = uxLen;
+		ptBuf->uxRef = 1;
+	}
+
+	return ptBuf;
+}
+
+/*****************************************************************************
+Function    : OSBufRef
+Description : Take one more reference to a buffer, to be dropped by OSBufFree().
+Input       : ptBuf -- the buffer.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSBufRef(tOSBuf_t *ptBuf)
+{
+	OSIntLock();
+	ptBuf->uxRef++;
+	OSIntUnock();
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSBufUnref
+Description : Drop one reference to a segment.
+Input       : ptBuf -- the segment.
+Output      : None
+Return      : OS_TRUE if the count dropped to zero, OS_FALSE otherwise.
+*****************************************************************************/
+static uOSBool_t OSBufUnref(tOSBuf_t *ptBuf)
+{
+	uOSMemSize_t uxRef;
+
+	OSIntLock();
+	uxRef = --ptBuf->uxRef;
+	OSIntUnock();
+
+	return (uxRef == 0U) ? OS_TRUE : OS_FALSE;
+}
+
+/*****************************************************************************
+Function    : OSBufFree
+Description : Drop one reference to a buffer. A segment whose count drops to zero
+              is put back on the heap, which in turn drops its link to the next
+              segment and its reference to the owner of its data. It does not
+              recurse: the owners released on the way are kept on a pending list
+              and freed after the current chain, however the chains are composed.
+Input       : ptBuf -- the buffer.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSBufFree(tOSBuf_t *ptBuf)
+{
+	tOSBuf_t *ptPending = OS_NULL;
+	tOSBuf_t *ptNext;
+	tOSBuf_t *ptOwner;
+
+	if (ptBuf == OS_NULL || OSBufUnref(ptBuf) == OS_FALSE)
+	{
+		return;
+	}
+
+	// every segment reaching this loop has a count of zero
+	while (ptBuf != OS_NULL)
+	{
+		ptNext = ptBuf->ptNext;
+		ptOwner = ptBuf->ptOwner;
+		OSMemFree(ptBuf);
+		if (ptOwner != OS_NULL && OSBufUnref(ptOwner) == OS_TRUE)
+		{
+			// an owner has no owner itself, so its ptOwner links the pending list
+			ptOwner->ptOwner = ptPending;
+			ptPending = ptOwner;
+		}
+
+		if (ptNext != OS_NULL && OSBufUnref(ptNext) == OS_TRUE)
+		{
+			ptBuf = ptNext;
+		}
+		else
+		{
+			// this chain is through, go on with a pending owner
+			ptBuf = ptPending;
+			if (ptPending != OS_NULL)
+			{
+				ptPending = ptPending->ptOwner;
+				ptBuf->ptOwner = OS_NULL;
+			}
+		}
+	}
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSBufHeaderPush
+Description : Prepend a header to the first segment by moving its payload start
+              back into the headroom. Nothing is copied.
+Input       : ptBuf -- the buffer.
+              uxSize -- bytes of the header.
+Output      : None
+Return      : OS_SUCESS, or OS_ERROR if the headroom is not enough or the segment
+              refers to data owned by another one.
+*****************************************************************************/
+uOSStatus_t OSBufHeaderPush(tOSBuf_t *ptBuf, uOSMemSize_t uxSize)
+{
+	if (ptBuf->ptOwner != OS_NULL || (uOS32_t)(ptBuf->puxPayload - OSBUF_DATA(ptBuf)) < uxSize)
+	{
+		return OS_ERROR;
+	}
+
+	ptBuf->puxPayload -= uxSize;
+	ptBuf->uxLen += uxSize;
+
+	return OS_SUCESS;
+}
+
+/*****************************************************************************
+Function    : OSBufHeaderPop
+Description : Strip a header from the first segment by moving its payload start
+              forward. Nothing is copied.
+Input       : ptBuf -- the buffer.
+              uxSize -- bytes of the header.
+Output      : None
+Return      : OS_SUCESS, or OS_ERROR if the first segment is shorter than uxSize.
+*****************************************************************************/
+uOSStatus_t OSBufHeaderPop(tOSBuf_t *ptBuf, uOSMemSize_t uxSize)
+{
+	if (ptBuf->uxLen < uxSize)
+	{
+		return OS_ERROR;
+	}
+
+	ptBuf->puxPayload += uxSize;
+	ptBuf->uxLen -= uxSize;
+
+	return OS_SUCESS;
+}
+
+/*****************************************************************************
+Function    : OSBufConcat
+Description : Append a buffer to the end of another one. The caller's reference
+              to ptTail becomes the link from the last segment of ptHead, so
+              ptTail must not be freed by the caller after this.
+Input       : ptHead -- the buffer to be extended.
+              ptTail -- the buffer to be appended.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSBufConcat(tOSBuf_t *ptHead, tOSBuf_t *ptTail)
+{
+	while (ptHead->ptNext != OS_NULL)
+	{
+		ptHead = ptHead->ptNext;
+	}
+	ptHead->ptNext = ptTail;
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSBufSlice
+Description : Make a new buffer referring to a part of another one. Every segment
+              of the new buffer points into the data of the original segments and
+              holds a reference to them, so nothing is copied and the original
+              buffer may be freed before the slice.
+Input       : ptBuf -- the buffer to be sliced.
+              uxOffset -- offset of the first byte of the slice.
+              uxLen -- bytes of the slice.
+Output      : None
+Return      : the slice with a reference count of 1, or OS_NULL if the range is
+              out of ptBuf, uxLen is 0, or there is no enough memory.
+*****************************************************************************/
+tOSBuf_t *OSBufSlice(tOSBuf_t *ptBuf, uOS32_t uxOffset, uOS32_t uxLen)
+{
+	tOSBuf_t *ptSlice = OS_NULL;
+	tOSBuf_t **pptLast = &ptSlice;
+	tOSBuf_t *ptSeg;
+	tOSBuf_t *ptOwner;
+	uOS32_t uxSegLen;
+
+	// skip the segments in front of uxOffset
+	while (ptBuf != OS_NULL && uxOffset >= ptBuf->uxLen)
+	{
+		uxOffset -= ptBuf->uxLen;
+		ptBuf = ptBuf->ptNext;
+	}
+
+	while (uxLen != 0U)
+	{
+		if (ptBuf == OS_NULL)
+		{
+			// the range is out of the buffer
+			OSBufFree(ptSlice);
+			return OS_NULL;
+		}
+
+		uxSegLen = ptBuf->uxLen - uxOffset;
+		if (uxSegLen > uxLen)
+		{
+			uxSegLen = uxLen;
+		}
+		if (uxSegLen != 0U)
+		{
+			ptSeg = (tOSBuf_t *)OSMemMalloc((uOSMemSize_t)SIZEOF_OSBUF_ALIGNED);
+			if (ptSeg == OS_NULL)
+			{
+				OSBufFree(ptSlice);
+				return OS_NULL;
+			}
+			ptOwner = (ptBuf->ptOwner != OS_NULL) ? ptBuf->ptOwner : ptBuf;
+			OSBufRef(ptOwner);
+			ptSeg->ptNext = OS_NULL;
+			ptSeg->ptOwner = ptOwner;
+			ptSeg->puxPayload = ptBuf->puxPayload + uxOffset;
+			ptSeg->uxLen = (uOSMemSize_t)uxSegLen;
+			ptSeg->uxRef = 1;
+			*pptLast = ptSeg;
+			pptLast = &ptSeg->ptNext;
+			uxLen -= uxSegLen;
+		}
+		uxOffset = 0;
+		ptBuf = ptBuf->ptNext;
+	}
+
+	return ptSlice;
+}
+
+/*****************************************************************************
+Function    : OSBufLength
+Description : Get the total bytes of data of a buffer.
+Input       : ptBuf -- the buffer.
+Output      : None
+Return      : sum of the lengths of all segments.
+*****************************************************************************/
+uOS32_t OSBufLength(tOSBuf_t *ptBuf)
+{
+	uOS32_t uxLen = 0;
+
+	for (; ptBuf != OS_NULL; ptBuf = ptBuf->ptNext)
+	{
+		uxLen += ptBuf->uxLen;
+	}
+
+	return uxLen;
+}
+
+/*****************************************************************************
+Function    : OSBufGetIoVec
+Description : Fill the segments of a buffer into a scatter-gather list, eg. for
+              the DMA descriptors of a driver. Empty segments are skipped.
+Input       : ptBuf -- the buffer.
+              ptIoVec -- the list to be filled.
+              uxMaxNum -- number of elements of ptIoVec.
+Output      : ptIoVec -- address and length of the segments.
+Return      : number of elements filled. If it is uxMaxNum, compare the sum of
+              the lengths with OSBufLength() to know whether all data fit.
+*****************************************************************************/
+uOSBase_t OSBufGetIoVec(tOSBuf_t *ptBuf, tOSIoVec_t *ptIoVec, uOSBase_t uxMaxNum)
+{
+	uOSBase_t uxNum = 0;
+
+	for (; ptBuf != OS_NULL && uxNum < uxMaxNum; ptBuf = ptBuf->ptNext)
+	{
+		if (ptBuf->uxLen != 0U)
+		{
+			ptIoVec[uxNum].pvBase = ptBuf->puxPayload;
+			ptIoVec[uxNum].uxLen = ptBuf->uxLen;
+			uxNum++;
+		}
+	}
+
+	return uxNum;
+}
+
+/*****************************************************************************
+Function    : OSBufCopyOut
+Description : Copy a part of a buffer into a flat memory area, for the consumers
+              which cannot walk the segments.
+Input       : ptBuf -- the buffer.
+              uxOffset -- offset of the first byte to be copied.
+              uxLen -- max bytes to be copied.
+Output      : pvDst -- the data copied.
+Return      : bytes copied.
+*****************************************************************************/
+uOS32_t OSBufCopyOut(tOSBuf_t *ptBuf, uOS32_t uxOffset, void *pvDst, uOS32_t uxLen)
+{
+	uOS8_t *puxDst = (uOS8_t *)pvDst;
+	uOS32_t uxCopied = 0;
+	uOS32_t uxSegLen;
+
+	for (; ptBuf != OS_NULL && uxCopied < uxLen; ptBuf = ptBuf->ptNext)
+	{
+		if (uxOffset >= ptBuf->uxLen)
+		{
+			uxOffset -= ptBuf->uxLen;
+			continue;
+		}
+		uxSegLen = ptBuf->uxLen - uxOffset;
+		if (uxSegLen > uxLen - uxCopied)
+		{
+			uxSegLen = uxLen - uxCopied;
+		}
+		OSMemCopy(puxDst + uxCopied, ptBuf->puxPayload + uxOffset, uxSegLen);
+		uxCopied += uxSegLen;
+		uxOffset = 0;
+	}
+
+	return uxCopied;
+}
+
+#endif //(OS_BUF_ON==1)
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,90 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#ifndef __OS_BUF_H_
+#define __OS_BUF_H_
+
+#include "OSType.h"
+#include "OSMemory.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (OS_BUF_ON==1)
+
+/** A segment of a buffer chain. A segment either owns its data, which is allocated
+ * together with it by OSBufAlloc() with some headroom in front of the payload, or
+ * refers to a part of the data owned by another segment(made by OSBufSlice()).
+ * uxRef counts the references to a segment: the handle given to the caller, the
+ * link from the previous segment of a chain and the segments referring to its data. */
+typedef struct _tOSBuf
+{
+	struct _tOSBuf *ptNext;		/** next segment of the chain, OS_NULL for the last */
+	struct _tOSBuf *ptOwner;	/** the segment owning the data, OS_NULL if itself */
+	uOS8_t *puxPayload;			/** the first byte of data in this segment */
+	uOSMemSize_t uxLen;			/** bytes of data in this segment */
+	uOSMemSize_t uxRef;			/** reference count */
+}tOSBuf_t;
+
+/** One element of a scatter-gather list, eg. for a DMA descriptor */
+typedef struct _tOSIoVec
+{
+	void *pvBase;
+	uOSMemSize_t uxLen;
+}tOSIoVec_t;
+
+tOSBuf_t    *OSBufAlloc(uOSMemSize_t uxHeadroom, uOSMemSize_t uxLen);
+void         OSBufRef(tOSBuf_t *ptBuf);
+void         OSBufFree(tOSBuf_t *ptBuf);
+uOSStatus_t  OSBufHeaderPush(tOSBuf_t *ptBuf, uOSMemSize_t uxSize);
+uOSStatus_t  OSBufHeaderPop(tOSBuf_t *ptBuf, uOSMemSize_t uxSize);
+void         OSBufConcat(tOSBuf_t *ptHead, tOSBuf_t *ptTail);
+tOSBuf_t    *OSBufSlice(tOSBuf_t *ptBuf, uOS32_t uxOffset, uOS32_t uxLen);
+uOS32_t      OSBufLength(tOSBuf_t *ptBuf);
+uOSBase_t    OSBufGetIoVec(tOSBuf_t *ptBuf, tOSIoVec_t *ptIoVec, uOSBase_t uxMaxNum);
+uOS32_t      OSBufCopyOut(tOSBuf_t *ptBuf, uOS32_t uxOffset, void *pvDst, uOS32_t uxLen);
+
+#endif //(OS_BUF_ON==1)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__OS_BUF_H_
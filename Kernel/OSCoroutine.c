@@ -0,0 +1,327 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#include "AIOS.h"
+#include "OSCoroutine.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (OS_COROUTINE_ON==1)
+
+/** all started coroutines, in order of priority(the highest first) */
+static tOSCoroutine_t *gptOSCoList = OS_NULL;
+/** the hooks to wake up and block the task running OSCoTask() */
+static OSCoWakeupHook_t gpfnOSCoWakeup = OS_NULL;
+static OSCoWaitHook_t gpfnOSCoWait = OS_NULL;
+static void *gpvOSCoHookArg = OS_NULL;
+
+/*****************************************************************************
+Function    : OSCoStart
+Description : Initialize a coroutine and add it to the scheduling list, after the
+              ones of the same priority. It must be called by the task running
+              OSCoSchedule()(eg. from a coroutine) or before that task starts.
+Input       : ptCo -- the coroutine.
+              pfnCoFunc -- the coroutine function.
+              pvArg -- the second parameter of pfnCoFunc.
+              uxPriority -- priority of the coroutine, 0~255.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSCoStart(tOSCoroutine_t *ptCo, OSCoFunction_t pfnCoFunc, void *pvArg, uOSBase_t uxPriority)
+{
+	tOSCoroutine_t **pptCo;
+
+	ptCo->pfnCoFunc = pfnCoFunc;
+	ptCo->pvArg = pvArg;
+	ptCo->pvWaitObj = OS_NULL;
+	ptCo->uxWakeTick = 0;
+	ptCo->uxLine = 0;
+	ptCo->uxPriority = (uOS8_t)uxPriority;
+	ptCo->uxState = OSCO_READY;
+#if (OS_STATIC_ALLOCATION_ON==0)
+	ptCo->uxDynamic = 0;
+#endif
+
+	for (pptCo = &gptOSCoList; *pptCo != OS_NULL; pptCo = &(*pptCo)->ptNext)
+	{
+		if ((*pptCo)->uxPriority < ptCo->uxPriority)
+		{
+			break;
+		}
+	}
+	ptCo->ptNext = *pptCo;
+	*pptCo = ptCo;
+
+	return;
+}
+
+#if (OS_STATIC_ALLOCATION_ON==0)
+/*****************************************************************************
+Function    : OSCoCreate
+Description : Allocate a coroutine from the heap and start it. It is put back on
+              the heap when it exits.
+Input       : pfnCoFunc -- the coroutine function.
+              pvArg -- the second parameter of pfnCoFunc.
+              uxPriority -- priority of the coroutine, 0~255.
+Output      : None
+Return      : the coroutine, or OS_NULL if there is no enough memory.
+*****************************************************************************/
+tOSCoroutine_t *OSCoCreate(OSCoFunction_t pfnCoFunc, void *pvArg, uOSBase_t uxPriority)
+{
+	tOSCoroutine_t *ptCo;
+
+	ptCo = (tOSCoroutine_t *)OSMemMalloc((uOSMemSize_t)sizeof(tOSCoroutine_t));
+	if (ptCo != OS_NULL)
+	{
+		OSCoStart(ptCo, pfnCoFunc, pvArg, uxPriority);
+		ptCo->uxDynamic = 1;
+	}
+
+	return ptCo;
+}
+#endif //(OS_STATIC_ALLOCATION_ON==0)
+
+/*****************************************************************************
+Function    : OSCoRemove
+Description : Take an exited coroutine out of the scheduling list.
+Input       : ptCo -- the coroutine.
+Output      : None
+Return      : None
+*****************************************************************************/
+static void OSCoRemove(tOSCoroutine_t *ptCo)
+{
+	tOSCoroutine_t **pptCo;
+
+	for (pptCo = &gptOSCoList; *pptCo != OS_NULL; pptCo = &(*pptCo)->ptNext)
+	{
+		if (*pptCo == ptCo)
+		{
+			*pptCo = ptCo->ptNext;
+			break;
+		}
+	}
+	ptCo->uxState = OSCO_DONE;
+#if (OS_STATIC_ALLOCATION_ON==0)
+	if (ptCo->uxDynamic != 0U)
+	{
+		OSMemFree(ptCo);
+	}
+#endif
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSCoSchedule
+Description : Run one pass over the coroutines in order of priority. Delayed ones
+              whose time has not come and ones waiting for a semaphore which is
+              not given are skipped without being called. It is called in the
+              loop of a task, all the coroutines share the stack of that task.
+              A coroutine in OSCO_WAIT_UNTIL() or OSCO_YIELD() is called in every
+              pass, so the task can block only while all of them are delayed or
+              waiting for a semaphore.
+Input       : None
+Output      : puxTicksToWait -- if it is not OS_NULL: the ticks until the first
+                                delayed coroutine wakes up, OSPEND_FOREVER_VALUE
+                                if none is delayed, or 0 if any was called.
+Return      : number of coroutines called, 0 if all of them are blocked.
+*****************************************************************************/
+uOSBase_t OSCoSchedule(uOSTick_t *puxTicksToWait)
+{
+	tOSCoroutine_t **pptCo = &gptOSCoList;
+	tOSCoroutine_t *ptCo;
+	uOSTick_t uxTickNow;
+	uOSTick_t uxTicksToWait = OSPEND_FOREVER_VALUE;
+	uOSBase_t uxNum = 0;
+
+	uxTickNow = OSGetTickCount();
+	while ((ptCo = *pptCo) != OS_NULL)
+	{
+		if (ptCo->uxState == OSCO_DELAYED)
+		{
+			if ((sOSTick_t)(uxTickNow - ptCo->uxWakeTick) < 0)
+			{
+				if ((uOSTick_t)(ptCo->uxWakeTick - uxTickNow) < uxTicksToWait)
+				{
+					uxTicksToWait = ptCo->uxWakeTick - uxTickNow;
+				}
+				pptCo = &ptCo->ptNext;
+				continue;
+			}
+			ptCo->uxState = OSCO_READY;
+		}
+		else if (ptCo->uxState == OSCO_SEM_WAIT)
+		{
+			if (((tOSCoSem_t *)ptCo->pvWaitObj)->uxCount == 0U)
+			{
+				pptCo = &ptCo->ptNext;
+				continue;
+			}
+		}
+
+		uxNum++;
+		if (ptCo->pfnCoFunc(ptCo, ptCo->pvArg) == OSCO_EXITED)
+		{
+			// *pptCo is the one after ptCo once it is removed
+			OSCoRemove(ptCo);
+		}
+		else
+		{
+			pptCo = &ptCo->ptNext;
+		}
+	}
+
+	if (puxTicksToWait != OS_NULL)
+	{
+		*puxTicksToWait = (uxNum != 0U) ? 0U : uxTicksToWait;
+	}
+
+	return uxNum;
+}
+
+/*****************************************************************************
+Function    : OSCoSetHook
+Description : Set the hooks used to wake up and block the task running OSCoTask(),
+              eg. giving and taking a semaphore. Without pfnWait, the task keeps
+              polling the coroutines and the lower priority tasks never run.
+Input       : pfnWakeup -- called from OSCoSemGive(), maybe in an interrupt.
+              pfnWait -- called by OSCoTask() when all coroutines are blocked,
+                         with the ticks until the first delayed one wakes up.
+              pvHookArg -- the first parameter of the hooks.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSCoSetHook(OSCoWakeupHook_t pfnWakeup, OSCoWaitHook_t pfnWait, void *pvHookArg)
+{
+	gpvOSCoHookArg = pvHookArg;
+	gpfnOSCoWait = pfnWait;
+	gpfnOSCoWakeup = pfnWakeup;
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSCoTask
+Description : The body of the task running the coroutines: run passes of
+              OSCoSchedule(), and wait with the pfnWait hook while all of the
+              coroutines are blocked.
+Input       : pvParameter -- not used.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSCoTask(void *pvParameter)
+{
+	uOSTick_t uxTicksToWait;
+
+	(void)pvParameter;
+	for (;;)
+	{
+		if (OSCoSchedule(&uxTicksToWait) == 0U && gpfnOSCoWait != OS_NULL)
+		{
+			gpfnOSCoWait(gpvOSCoHookArg, uxTicksToWait);
+		}
+	}
+}
+
+/*****************************************************************************
+Function    : OSCoSemInit
+Description : Initialize a coroutine semaphore.
+Input       : ptSem -- the semaphore.
+              uxCount -- the initial count.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSCoSemInit(tOSCoSem_t *ptSem, uOSBase_t uxCount)
+{
+	ptSem->uxCount = uxCount;
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSCoSemGive
+Description : Give a coroutine semaphore, from a task, a coroutine or an ISR, and
+              wake up the task running the coroutines by the pfnWakeup hook.
+Input       : ptSem -- the semaphore.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSCoSemGive(tOSCoSem_t *ptSem)
+{
+	OSIntLock();
+	ptSem->uxCount++;
+	OSIntUnock();
+
+	if (gpfnOSCoWakeup != OS_NULL)
+	{
+		gpfnOSCoWakeup(gpvOSCoHookArg);
+	}
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSCoSemTryTake
+Description : Take a coroutine semaphore if it is given, never waits.
+Input       : ptSem -- the semaphore.
+Output      : None
+Return      : OS_TRUE if taken, or OS_FALSE.
+*****************************************************************************/
+uOSBool_t OSCoSemTryTake(tOSCoSem_t *ptSem)
+{
+	uOSBool_t bTaken = OS_FALSE;
+
+	OSIntLock();
+	if (ptSem->uxCount != 0U)
+	{
+		ptSem->uxCount--;
+		bTaken = OS_TRUE;
+	}
+	OSIntUnock();
+
+	return bTaken;
+}
+
+#endif //(OS_COROUTINE_ON==1)
+
+#ifdef __cplusplus
+}
+#endif
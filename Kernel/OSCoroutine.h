@@ -0,0 +1,145 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#ifndef __OS_COROUTINE_H_
+#define __OS_COROUTINE_H_
+
+#include "OSType.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (OS_COROUTINE_ON==1)
+
+/** Return values of a coroutine function */
+#define OSCO_WAITING			( 0 )
+#define OSCO_EXITED				( 1 )
+
+/** States of a coroutine */
+#define OSCO_READY				( 0 )
+#define OSCO_DELAYED			( 1 )
+#define OSCO_SEM_WAIT			( 2 )
+#define OSCO_DONE				( 3 )
+
+typedef struct _tOSCoroutine tOSCoroutine_t;
+typedef sOSBase_t (*OSCoFunction_t)( tOSCoroutine_t *, void * );
+/** Hook to wake up the task running the coroutines, eg. give a semaphore */
+typedef void (*OSCoWakeupHook_t)( void * );
+/** Hook to block the task running the coroutines for at most some ticks(or
+ * OSPEND_FOREVER_VALUE), eg. take a semaphore with a timeout */
+typedef void (*OSCoWaitHook_t)( void *, uOSTick_t );
+
+/** A stackless coroutine. It has no stack of its own: its function runs on the
+ * stack of the task calling OSCoSchedule() and returns at every wait, so local
+ * variables are lost across a wait. Keep the state to be kept in *pvArg. */
+struct _tOSCoroutine
+{
+	tOSCoroutine_t *ptNext;		/** next coroutine, in order of priority */
+	OSCoFunction_t pfnCoFunc;	/** the coroutine function */
+	void *pvArg;				/** the second parameter of pfnCoFunc */
+	void *pvWaitObj;			/** the semaphore waited for */
+	uOSTick_t uxWakeTick;		/** the tick to wake up at when delayed */
+	uOS16_t uxLine;				/** where to resume, 0 for the start */
+	uOS8_t uxPriority;			/** the higher, the earlier in a pass of OSCoSchedule() */
+	uOS8_t uxState;				/** OSCO_READY, OSCO_DELAYED, ... */
+#if (OS_STATIC_ALLOCATION_ON==0)
+	uOS8_t uxDynamic;			/** allocated by OSCoCreate() */
+#endif
+};
+
+/** A counting semaphore to be waited for by coroutines, can be given from ISRs */
+typedef struct _tOSCoSem
+{
+	volatile uOSBase_t uxCount;
+}tOSCoSem_t;
+
+void            OSCoStart(tOSCoroutine_t *ptCo, OSCoFunction_t pfnCoFunc, void *pvArg, uOSBase_t uxPriority);
+#if (OS_STATIC_ALLOCATION_ON==0)
+tOSCoroutine_t *OSCoCreate(OSCoFunction_t pfnCoFunc, void *pvArg, uOSBase_t uxPriority);
+#endif
+uOSBase_t       OSCoSchedule(uOSTick_t *puxTicksToWait);
+void            OSCoSetHook(OSCoWakeupHook_t pfnWakeup, OSCoWaitHook_t pfnWait, void *pvHookArg);
+void            OSCoTask(void *pvParameter);
+void            OSCoSemInit(tOSCoSem_t *ptSem, uOSBase_t uxCount);
+void            OSCoSemGive(tOSCoSem_t *ptSem);
+uOSBool_t       OSCoSemTryTake(tOSCoSem_t *ptSem);
+
+/** Declare a coroutine, reserved at link time and started by OSCoStart() */
+#define OSCO_DEFINE(Name)				tOSCoroutine_t Name
+
+/** Declare a semaphore for coroutines, initialized at link time */
+#define OSCOSEM_DEFINE(Name, Count)		tOSCoSem_t Name = { (Count) }
+
+/** The body of a coroutine function must be put between OSCO_BEGIN and OSCO_END.
+ * The resume points are case labels of a switch numbered by __LINE__, so a wait
+ * must not be put inside another switch statement of the body, and no two waits
+ * can be on the same source line. */
+#define OSCO_BEGIN(ptCo)		switch ((ptCo)->uxLine) { case 0:
+
+#define OSCO_END(ptCo)			} (ptCo)->uxLine = 0; return OSCO_EXITED
+
+/** End the coroutine at once */
+#define OSCO_EXIT(ptCo)			do { (ptCo)->uxLine = 0; return OSCO_EXITED; } while (0)
+
+/** Give the other coroutines a chance to run */
+#define OSCO_YIELD(ptCo)		do { (ptCo)->uxLine = (uOS16_t)__LINE__; return OSCO_WAITING; \
+									case __LINE__:; } while (0)
+
+/** Wait until a condition is true, it is evaluated once per pass of OSCoSchedule() */
+#define OSCO_WAIT_UNTIL(ptCo, Cond)	do { (ptCo)->uxLine = (uOS16_t)__LINE__; case __LINE__: \
+									if (!(Cond)) { return OSCO_WAITING; } } while (0)
+
+/** Sleep for some ticks, OSCoSchedule() does not call the coroutine until then */
+#define OSCO_DELAY(ptCo, Ticks)	do { (ptCo)->uxWakeTick = OSGetTickCount() + (uOSTick_t)(Ticks); \
+									(ptCo)->uxState = OSCO_DELAYED; OSCO_YIELD(ptCo); } while (0)
+
+/** Take a tOSCoSem_t, OSCoSchedule() does not call the coroutine until it is given */
+#define OSCO_SEM_TAKE(ptCo, ptSem)	do { (ptCo)->pvWaitObj = (void *)(ptSem); (ptCo)->uxState = OSCO_SEM_WAIT; \
+									(ptCo)->uxLine = (uOS16_t)__LINE__; case __LINE__: \
+									if (OSCoSemTryTake(ptSem) == OS_FALSE) { return OSCO_WAITING; } \
+									(ptCo)->uxState = OSCO_READY; } while (0)
+
+#endif //(OS_COROUTINE_ON==1)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__OS_COROUTINE_H_
@@ -0,0 +1,269 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#include "AIOS.h"
+#include "OSMemArena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (OS_MEMARENA_ON==1)
+
+#define SIZEOF_OSMEMARENA_ALIGNED	OSMEM_ALIGN_SIZE(sizeof(tOSMemArena_t))
+#define SIZEOF_OSMEMCHUNK_ALIGNED	OSMEM_ALIGN_SIZE(sizeof(tOSMemChunk_t))
+/** the first byte of the data of a chunk */
+#define OSMEMCHUNK_DATA(ptChunk)	((uOS8_t *)(ptChunk) + SIZEOF_OSMEMCHUNK_ALIGNED)
+
+/*****************************************************************************
+Function    : OSMemArenaInit
+Description : Initialize an arena on a given buffer, which becomes its first chunk.
+              More chunks are taken from the heap when it runs out, if there is
+              a heap.
+Input       : ptArena -- the arena.
+              pvBuffer -- the buffer, eg. reserved by OSMEMARENA_DEFINE().
+              uxBufferSize -- size of the buffer in bytes, it is also the data
+                              size of the chunks taken later.
+Output      : None
+Return      : OS_SUCESS, or OS_ERROR if the buffer cannot hold a chunk header.
+*****************************************************************************/
+uOSStatus_t OSMemArenaInit(tOSMemArena_t *ptArena, void *pvBuffer, uOSMemSize_t uxBufferSize)
+{
+	tOSMemChunk_t *ptChunk;
+	uOS8_t *puxEnd;
+
+	ptChunk = (tOSMemChunk_t *)OSMEM_ALIGN_ADDR(pvBuffer);
+	puxEnd = (uOS8_t *)pvBuffer + uxBufferSize;
+	if (puxEnd < OSMEMCHUNK_DATA(ptChunk))
+	{
+		return OS_ERROR;
+	}
+
+	ptChunk->ptNext = OS_NULL;
+	ptChunk->puxEnd = puxEnd;
+	ptArena->ptFirst = ptChunk;
+	ptArena->ptCurrent = ptChunk;
+	ptArena->puxNext = OSMEMCHUNK_DATA(ptChunk);
+	ptArena->uxChunkSize = (uOSMemSize_t)OSMEM_ALIGN_SIZE((uOS32_t)(puxEnd - OSMEMCHUNK_DATA(ptChunk)));
+	ptArena->uxDynamic = 0;
+
+	return OS_SUCESS;
+}
+
+#if (OS_HEAP_ON==1)
+/*****************************************************************************
+Function    : OSMemArenaCreate
+Description : Create an arena. The arena and its first chunk are taken from the
+              heap in one block, more chunks are taken when it runs out.
+Input       : uxChunkSize -- data size of a chunk, larger allocations get a chunk
+                             of their own size.
+Output      : None
+Return      : the arena, or OS_NULL if there is no enough memory.
+*****************************************************************************/
+tOSMemArena_t *OSMemArenaCreate(uOSMemSize_t uxChunkSize)
+{
+	tOSMemArena_t *ptArena;
+	uOS32_t uxSize;
+
+	uxChunkSize = OSMEM_ALIGN_SIZE(uxChunkSize);
+	uxSize = (uOS32_t)SIZEOF_OSMEMARENA_ALIGNED + SIZEOF_OSMEMCHUNK_ALIGNED + uxChunkSize;
+	if ((uOS32_t)(uOSMemSize_t)uxSize != uxSize)
+	{
+		return OS_NULL;
+	}
+
+	ptArena = (tOSMemArena_t *)OSMemMalloc((uOSMemSize_t)uxSize);
+	if (ptArena != OS_NULL)
+	{
+		(void)OSMemArenaInit(ptArena, (uOS8_t *)ptArena + SIZEOF_OSMEMARENA_ALIGNED,
+							 (uOSMemSize_t)(uxSize - SIZEOF_OSMEMARENA_ALIGNED));
+		ptArena->uxDynamic = 1;
+	}
+
+	return ptArena;
+}
+#endif //(OS_HEAP_ON==1)
+
+/*****************************************************************************
+Function    : OSMemArenaAlloc
+Description : Allocate memory from an arena. In the common case it only bumps a
+              pointer. When the current chunk is used up, the next chunk kept
+              from before a reset is used, or a new chunk is taken from the heap
+              if there is a heap.
+Input       : ptArena -- the arena.
+              uxSize -- bytes to be allocated.
+Output      : None
+Return      : the memory aligned to OSMEM_ALIGNMENT, or OS_NULL if there is no
+              enough memory. It cannot be freed alone.
+*****************************************************************************/
+void *OSMemArenaAlloc(tOSMemArena_t *ptArena, uOSMemSize_t uxSize)
+{
+	tOSMemChunk_t *ptChunk;
+	uOS8_t *puxMem;
+	uOS32_t uxAligned;
+#if (OS_HEAP_ON==1)
+	uOS32_t uxChunkSize;
+	uOS32_t uxBlockSize;
+#endif
+
+	uxAligned = OSMEM_ALIGN_SIZE((uOS32_t)uxSize);
+	if ((uOS32_t)(ptArena->ptCurrent->puxEnd - ptArena->puxNext) < uxAligned)
+	{
+		ptChunk = ptArena->ptCurrent->ptNext;
+		if (ptChunk == OS_NULL || (uOS32_t)(ptChunk->puxEnd - OSMEMCHUNK_DATA(ptChunk)) < uxAligned)
+		{
+#if (OS_HEAP_ON==1)
+			// no kept chunk fits, take a new one and put it after the current one
+			uxChunkSize = (uxAligned > ptArena->uxChunkSize) ? uxAligned : ptArena->uxChunkSize;
+			uxBlockSize = (uOS32_t)SIZEOF_OSMEMCHUNK_ALIGNED + uxChunkSize;
+			if ((uOS32_t)(uOSMemSize_t)uxBlockSize != uxBlockSize)
+			{
+				return OS_NULL;
+			}
+			ptChunk = (tOSMemChunk_t *)OSMemMalloc((uOSMemSize_t)uxBlockSize);
+			if (ptChunk == OS_NULL)
+			{
+				return OS_NULL;
+			}
+			ptChunk->puxEnd = OSMEMCHUNK_DATA(ptChunk) + uxChunkSize;
+			ptChunk->ptNext = ptArena->ptCurrent->ptNext;
+			ptArena->ptCurrent->ptNext = ptChunk;
+#else
+			return OS_NULL;
+#endif
+		}
+		ptArena->ptCurrent = ptChunk;
+		ptArena->puxNext = OSMEMCHUNK_DATA(ptChunk);
+	}
+
+	puxMem = ptArena->puxNext;
+	ptArena->puxNext += uxAligned;
+
+	return puxMem;
+}
+
+/*****************************************************************************
+Function    : OSMemArenaReset
+Description : Release everything allocated from an arena in constant time. The
+              chunks are kept and reused by the following allocations.
+Input       : ptArena -- the arena.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSMemArenaReset(tOSMemArena_t *ptArena)
+{
+	ptArena->ptCurrent = ptArena->ptFirst;
+	ptArena->puxNext = OSMEMCHUNK_DATA(ptArena->ptFirst);
+
+	return;
+}
+
+#if (OS_HEAP_ON==1)
+/*****************************************************************************
+Function    : OSMemArenaDestroy
+Description : Put all chunks taken from the heap by an arena back on the heap,
+              and the arena too if it is from OSMemArenaCreate(). An arena from
+              OSMemArenaInit() is left empty on its own buffer.
+Input       : ptArena -- the arena.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSMemArenaDestroy(tOSMemArena_t *ptArena)
+{
+	tOSMemChunk_t *ptChunk;
+	tOSMemChunk_t *ptNext;
+
+	// the first chunk is in the block of the arena or in the given buffer
+	for (ptChunk = ptArena->ptFirst->ptNext; ptChunk != OS_NULL; ptChunk = ptNext)
+	{
+		ptNext = ptChunk->ptNext;
+		OSMemFree(ptChunk);
+	}
+	if (ptArena->uxDynamic != 0U)
+	{
+		OSMemFree(ptArena);
+	}
+	else
+	{
+		ptArena->ptFirst->ptNext = OS_NULL;
+		OSMemArenaReset(ptArena);
+	}
+
+	return;
+}
+#endif //(OS_HEAP_ON==1)
+
+/*****************************************************************************
+Function    : OSMemArenaMark
+Description : Remember the current position of an arena, to open a nested scope
+              which is closed by OSMemArenaRelease().
+Input       : ptArena -- the arena.
+Output      : ptMark -- the position.
+Return      : None
+*****************************************************************************/
+void OSMemArenaMark(tOSMemArena_t *ptArena, tOSMemArenaMark_t *ptMark)
+{
+	ptMark->ptChunk = ptArena->ptCurrent;
+	ptMark->puxNext = ptArena->puxNext;
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSMemArenaRelease
+Description : Release everything allocated from an arena after a mark in constant
+              time. The marks taken after ptMark become invalid.
+Input       : ptArena -- the arena.
+              ptMark -- the position set by OSMemArenaMark().
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSMemArenaRelease(tOSMemArena_t *ptArena, tOSMemArenaMark_t *ptMark)
+{
+	ptArena->ptCurrent = ptMark->ptChunk;
+	ptArena->puxNext = ptMark->puxNext;
+
+	return;
+}
+
+#endif //(OS_MEMARENA_ON==1)
+
+#ifdef __cplusplus
+}
+#endif
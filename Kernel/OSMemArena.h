@@ -0,0 +1,103 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#ifndef __OS_MEM_ARENA_H_
+#define __OS_MEM_ARENA_H_
+
+#include "OSType.h"
+#include "OSMemory.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (OS_MEMARENA_ON==1)
+
+/** A chunk of memory taken from the heap by an arena, the data follows it */
+typedef struct _tOSMemChunk
+{
+	struct _tOSMemChunk *ptNext;	/** next chunk, the later ones are reused after a reset */
+	uOS8_t *puxEnd;					/** end of the data of this chunk */
+}tOSMemChunk_t;
+
+/** An arena(region): objects are allocated by bumping a pointer through its chunks
+ * and are all released at once. An arena is not protected from concurrent access,
+ * it is meant to be used by one task, eg. for the data of one request. */
+typedef struct _tOSMemArena
+{
+	tOSMemChunk_t *ptFirst;			/** the chunk allocated with the arena */
+	tOSMemChunk_t *ptCurrent;		/** the chunk being allocated from */
+	uOS8_t *puxNext;				/** next free byte in ptCurrent */
+	uOSMemSize_t uxChunkSize;		/** data size of a new chunk */
+	uOS8_t uxDynamic;				/** allocated by OSMemArenaCreate() */
+}tOSMemArena_t;
+
+/** A position in an arena, to release everything allocated after it */
+typedef struct _tOSMemArenaMark
+{
+	tOSMemChunk_t *ptChunk;
+	uOS8_t *puxNext;
+}tOSMemArenaMark_t;
+
+uOSStatus_t    OSMemArenaInit(tOSMemArena_t *ptArena, void *pvBuffer, uOSMemSize_t uxBufferSize);
+void          *OSMemArenaAlloc(tOSMemArena_t *ptArena, uOSMemSize_t uxSize);
+void           OSMemArenaReset(tOSMemArena_t *ptArena);
+void           OSMemArenaMark(tOSMemArena_t *ptArena, tOSMemArenaMark_t *ptMark);
+void           OSMemArenaRelease(tOSMemArena_t *ptArena, tOSMemArenaMark_t *ptMark);
+#if (OS_HEAP_ON==1)
+tOSMemArena_t *OSMemArenaCreate(uOSMemSize_t uxChunkSize);
+void           OSMemArenaDestroy(tOSMemArena_t *ptArena);
+#endif
+
+/** Declare an arena whose first chunk holds Size bytes, reserved at link time.
+ * OSMEMARENA_INIT() initializes it before use. */
+#define OSMEMARENA_DEFINE(Name, Size)	static uOS8_t gauxOSMemArena_##Name[OSMEM_ALIGN_BUFFER( \
+										OSMEM_ALIGN_SIZE(sizeof(tOSMemChunk_t)) + OSMEM_ALIGN_SIZE(Size))]; \
+										tOSMemArena_t Name
+
+#define OSMEMARENA_INIT(Name)			OSMemArenaInit(&(Name), gauxOSMemArena_##Name, \
+										(uOSMemSize_t)sizeof(gauxOSMemArena_##Name))
+
+#endif //(OS_MEMARENA_ON==1)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__OS_MEM_ARENA_H_
@@ -0,0 +1,223 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#ifndef __OS_MEM_RESOURCE_H_
+#define __OS_MEM_RESOURCE_H_
+
+/** C++17 std::pmr::memory_resource adapters over the AIOS heap and arenas.
+ * Include this header from C++ code directly, not through AIOS.h which is
+ * wrapped in extern "C". */
+#if defined(__cplusplus) && (__cplusplus >= 201703L)
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <memory_resource>
+#include "AIOS.h"
+
+/** Report an allocation failure: throw std::bad_alloc when exceptions are on,
+ * otherwise return a null pointer, which is what a -fno-exceptions build expects */
+#if defined(__cpp_exceptions)
+#define OSMEM_BAD_ALLOC()		throw std::bad_alloc()
+#else
+#define OSMEM_BAD_ALLOC()		return nullptr
+#endif
+
+#if (OS_HEAP_ON==1)
+/** Memory resource over OSMemMalloc()/OSMemFree(). Blocks are OSMEM_ALIGNMENT
+ * aligned; a stricter alignment is met by over-allocating and keeping the
+ * pointer returned by OSMemMalloc() in front of the aligned block. */
+class OSMemHeapResource : public std::pmr::memory_resource
+{
+public:
+	static void *Allocate(std::size_t uxBytes, std::size_t uxAlignment)
+	{
+		if (uxAlignment <= OSMEM_ALIGNMENT)
+		{
+			return Malloc(uxBytes);
+		}
+
+		std::uintptr_t uxRaw = reinterpret_cast<std::uintptr_t>(Malloc(uxBytes + uxAlignment + sizeof(void *)));
+		if (uxRaw == 0U)
+		{
+			return nullptr;
+		}
+		std::uintptr_t uxAligned = (uxRaw + sizeof(void *) + uxAlignment - 1U) & ~(std::uintptr_t)(uxAlignment - 1U);
+		reinterpret_cast<void **>(uxAligned)[-1] = reinterpret_cast<void *>(uxRaw);
+		return reinterpret_cast<void *>(uxAligned);
+	}
+
+	static void Free(void *pMem, std::size_t uxAlignment)
+	{
+		if (pMem != nullptr && uxAlignment > OSMEM_ALIGNMENT)
+		{
+			pMem = static_cast<void **>(pMem)[-1];
+		}
+		OSMemFree(pMem);
+	}
+
+private:
+	static void *Malloc(std::size_t uxBytes)
+	{
+		// OSMemMalloc() takes uOSMemSize_t and returns OS_NULL for 0 bytes
+		if (uxBytes == 0U)
+		{
+			uxBytes = 1U;
+		}
+		if (static_cast<std::size_t>(static_cast<uOSMemSize_t>(uxBytes)) != uxBytes)
+		{
+			return nullptr;
+		}
+		return OSMemMalloc(static_cast<uOSMemSize_t>(uxBytes));
+	}
+
+	void *do_allocate(std::size_t uxBytes, std::size_t uxAlignment) override
+	{
+		void *pMem = Allocate(uxBytes, uxAlignment);
+		if (pMem == nullptr)
+		{
+			OSMEM_BAD_ALLOC();
+		}
+		return pMem;
+	}
+
+	void do_deallocate(void *pMem, std::size_t, std::size_t uxAlignment) override
+	{
+		Free(pMem, uxAlignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &tOther) const noexcept override
+	{
+		// compared by identity, which needs no RTTI: share the one instance from
+		// OSMemGetHeapResource() so that containers see the same resource
+		return this == &tOther;
+	}
+};
+
+/** The heap resource shared by all users, eg. for std::pmr::set_default_resource() */
+inline OSMemHeapResource *OSMemGetHeapResource()
+{
+	static OSMemHeapResource tHeapResource;
+	return &tHeapResource;
+}
+#endif //(OS_HEAP_ON==1)
+
+#if (OS_MEMARENA_ON==1)
+/** Memory resource over an arena: allocation bumps a pointer and deallocation
+ * does nothing, the memory comes back at Reset() or when the resource is
+ * destroyed. Like the arena itself, it is meant to be used by one task. */
+class OSMemArenaResource : public std::pmr::memory_resource
+{
+public:
+	/** Use an arena initialized by the caller, eg. by OSMEMARENA_INIT() */
+	explicit OSMemArenaResource(tOSMemArena_t *ptArena) : m_ptArena(ptArena), m_bOwner(false)
+	{
+	}
+
+#if (OS_HEAP_ON==1)
+	explicit OSMemArenaResource(uOSMemSize_t uxChunkSize) : m_ptArena(OSMemArenaCreate(uxChunkSize)), m_bOwner(true)
+	{
+	}
+
+	~OSMemArenaResource() override
+	{
+		if (m_ptArena != nullptr && m_bOwner)
+		{
+			OSMemArenaDestroy(m_ptArena);
+		}
+	}
+#endif
+
+	OSMemArenaResource(const OSMemArenaResource &) = delete;
+	OSMemArenaResource &operator=(const OSMemArenaResource &) = delete;
+
+	/** Release everything allocated from the resource at once */
+	void Reset()
+	{
+		if (m_ptArena != nullptr)
+		{
+			OSMemArenaReset(m_ptArena);
+		}
+	}
+
+	tOSMemArena_t *GetArena() const
+	{
+		return m_ptArena;
+	}
+
+private:
+	tOSMemArena_t *m_ptArena;
+	bool m_bOwner;				/** the arena is created and destroyed by the resource */
+
+	void *do_allocate(std::size_t uxBytes, std::size_t uxAlignment) override
+	{
+		std::size_t uxExtra = (uxAlignment > OSMEM_ALIGNMENT) ? uxAlignment - OSMEM_ALIGNMENT : 0U;
+		std::size_t uxTotal = uxBytes + uxExtra;
+		void *pMem = nullptr;
+
+		if (m_ptArena != nullptr && static_cast<std::size_t>(static_cast<uOSMemSize_t>(uxTotal)) == uxTotal)
+		{
+			pMem = OSMemArenaAlloc(m_ptArena, static_cast<uOSMemSize_t>(uxTotal));
+		}
+		if (pMem == nullptr)
+		{
+			OSMEM_BAD_ALLOC();
+		}
+		if (uxExtra != 0U)
+		{
+			std::uintptr_t uxAligned = (reinterpret_cast<std::uintptr_t>(pMem) + uxAlignment - 1U) & ~(std::uintptr_t)(uxAlignment - 1U);
+			pMem = reinterpret_cast<void *>(uxAligned);
+		}
+		return pMem;
+	}
+
+	void do_deallocate(void *, std::size_t, std::size_t) override
+	{
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &tOther) const noexcept override
+	{
+		return this == &tOther;
+	}
+};
+#endif //(OS_MEMARENA_ON==1)
+
+#endif //defined(__cplusplus) && (__cplusplus >= 201703L)
+
+#endif //__OS_MEM_RESOURCE_H_
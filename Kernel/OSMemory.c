@@ -45,6 +45,8 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 extern "C" {
 #endif
 
+#if (OS_HEAP_ON==1)
+
 /**
  * The heap is made up as a list of structs of this type.
  * This does not have to be aligned since for getting its size,
@@ -442,6 +444,231 @@ void* OSMemMalloc(uOSMemSize_t size)
 	return pResult;
 }
 
+#endif //(OS_HEAP_ON==1)
+
+#if (OS_MEM_WORD_COPY_ON==1)
+/** the word used by OSMemSet(), OSMemCopy() and OSMemMove() */
+#define OSMEM_WORD_SIZE			( sizeof(uOSBase_t) )
+#define OSMEM_WORD_MASK			( OSMEM_WORD_SIZE - 1U )
+
+/***************************************************************************** 
+Function    : OSMemSet 
+Description : Fill a memory area with a byte value. The bytes up to the first
+              word boundary are set one by one, then whole words are stored four
+              at a time. For a block returned by OSMemMalloc() with a size of a
+              multiple of OSMEM_ALIGNMENT, only the word stores are done.
+Input       : pDst -- the memory area to be filled.
+              uxValue -- the byte value.
+              uxLen -- number of bytes to be filled.
+Output      : None 
+Return      : pDst
+*****************************************************************************/ 
+void* OSMemSet(void *pDst, uOS8_t uxValue, uOSBase_t uxLen)
+{
+	uOS8_t *puxDst = (uOS8_t *)pDst;
+	uOSBase_t *puxWord;
+	uOSBase_t uxWord;
+
+	while (uxLen != 0U && ((uOSAddr_t)puxDst & OSMEM_WORD_MASK) != 0U)
+	{
+		*puxDst++ = uxValue;
+		uxLen--;
+	}
+
+	// spread the byte over a word: 0xXX * 0x0101..01
+	uxWord = (uOSBase_t)uxValue * ((uOSBase_t)~(uOSBase_t)0 / 0xFFU);
+	puxWord = (uOSBase_t *)(void *)puxDst;
+	for (; uxLen >= 4U * OSMEM_WORD_SIZE; uxLen -= 4U * OSMEM_WORD_SIZE, puxWord += 4)
+	{
+		puxWord[0] = uxWord;
+		puxWord[1] = uxWord;
+		puxWord[2] = uxWord;
+		puxWord[3] = uxWord;
+	}
+	for (; uxLen >= OSMEM_WORD_SIZE; uxLen -= OSMEM_WORD_SIZE)
+	{
+		*puxWord++ = uxWord;
+	}
+
+	puxDst = (uOS8_t *)puxWord;
+	while (uxLen != 0U)
+	{
+		*puxDst++ = uxValue;
+		uxLen--;
+	}
+
+	return pDst;
+}
+
+/***************************************************************************** 
+Function    : OSMemCopy 
+Description : Copy a memory area to another one, which must not overlap with it
+              unless pDst is below pSrc. When both areas share the same offset
+              to a word boundary, whole words are copied four at a time;
+              otherwise memmove() of the C library is used, which handles
+              mutually misaligned areas better and keeps the overlap safe.
+Input       : pDst -- the destination.
+              pSrc -- the source.
+              uxLen -- number of bytes to be copied.
+Output      : None 
+Return      : pDst
+*****************************************************************************/ 
+void* OSMemCopy(void *pDst, const void *pSrc, uOSBase_t uxLen)
+{
+	uOS8_t *puxDst = (uOS8_t *)pDst;
+	const uOS8_t *puxSrc = (const uOS8_t *)pSrc;
+	uOSBase_t *puxDstWord;
+	const uOSBase_t *puxSrcWord;
+
+	if ((((uOSAddr_t)puxDst ^ (uOSAddr_t)puxSrc) & OSMEM_WORD_MASK) != 0U)
+	{
+		return memmove(pDst, pSrc, uxLen);
+	}
+
+	while (uxLen != 0U && ((uOSAddr_t)puxDst & OSMEM_WORD_MASK) != 0U)
+	{
+		*puxDst++ = *puxSrc++;
+		uxLen--;
+	}
+
+	puxDstWord = (uOSBase_t *)(void *)puxDst;
+	puxSrcWord = (const uOSBase_t *)(const void *)puxSrc;
+	for (; uxLen >= 4U * OSMEM_WORD_SIZE; uxLen -= 4U * OSMEM_WORD_SIZE, puxDstWord += 4, puxSrcWord += 4)
+	{
+		puxDstWord[0] = puxSrcWord[0];
+		puxDstWord[1] = puxSrcWord[1];
+		puxDstWord[2] = puxSrcWord[2];
+		puxDstWord[3] = puxSrcWord[3];
+	}
+	for (; uxLen >= OSMEM_WORD_SIZE; uxLen -= OSMEM_WORD_SIZE)
+	{
+		*puxDstWord++ = *puxSrcWord++;
+	}
+
+	puxDst = (uOS8_t *)puxDstWord;
+	puxSrc = (const uOS8_t *)puxSrcWord;
+	while (uxLen != 0U)
+	{
+		*puxDst++ = *puxSrc++;
+		uxLen--;
+	}
+
+	return pDst;
+}
+
+/***************************************************************************** 
+Function    : OSMemMove 
+Description : Copy a memory area to another one which may overlap with it. If
+              pDst is above pSrc and they overlap, the copy runs backward in
+              the same way as OSMemCopy() does forward. Mutually misaligned
+              areas are left to memmove() of the C library.
+Input       : pDst -- the destination.
+              pSrc -- the source.
+              uxLen -- number of bytes to be copied.
+Output      : None 
+Return      : pDst
+*****************************************************************************/ 
+void* OSMemMove(void *pDst, const void *pSrc, uOSBase_t uxLen)
+{
+	uOS8_t *puxDst = (uOS8_t *)pDst + uxLen;
+	const uOS8_t *puxSrc = (const uOS8_t *)pSrc + uxLen;
+	uOSBase_t *puxDstWord;
+	const uOSBase_t *puxSrcWord;
+
+	if ((uOS8_t *)pDst <= (const uOS8_t *)pSrc || (uOS8_t *)pDst >= puxSrc)
+	{
+		// forward copy is safe
+		return OSMemCopy(pDst, pSrc, uxLen);
+	}
+
+	if ((((uOSAddr_t)puxDst ^ (uOSAddr_t)puxSrc) & OSMEM_WORD_MASK) != 0U)
+	{
+		memmove(puxDst - uxLen, puxSrc - uxLen, uxLen);
+		return pDst;
+	}
+
+	while (uxLen != 0U && ((uOSAddr_t)puxDst & OSMEM_WORD_MASK) != 0U)
+	{
+		*--puxDst = *--puxSrc;
+		uxLen--;
+	}
+
+	puxDstWord = (uOSBase_t *)(void *)puxDst;
+	puxSrcWord = (const uOSBase_t *)(const void *)puxSrc;
+	for (; uxLen >= 4U * OSMEM_WORD_SIZE; uxLen -= 4U * OSMEM_WORD_SIZE)
+	{
+		puxDstWord -= 4;
+		puxSrcWord -= 4;
+		puxDstWord[3] = puxSrcWord[3];
+		puxDstWord[2] = puxSrcWord[2];
+		puxDstWord[1] = puxSrcWord[1];
+		puxDstWord[0] = puxSrcWord[0];
+	}
+	for (; uxLen >= OSMEM_WORD_SIZE; uxLen -= OSMEM_WORD_SIZE)
+	{
+		*--puxDstWord = *--puxSrcWord;
+	}
+
+	puxDst = (uOS8_t *)puxDstWord;
+	puxSrc = (const uOS8_t *)puxSrcWord;
+	while (uxLen != 0U)
+	{
+		*--puxDst = *--puxSrc;
+		uxLen--;
+	}
+
+	return pDst;
+}
+
+#else
+
+/***************************************************************************** 
+Function    : OSMemSet 
+Description : Fill a memory area with a byte value by memset() of the C library.
+Input       : pDst -- the memory area to be filled.
+              uxValue -- the byte value.
+              uxLen -- number of bytes to be filled.
+Output      : None 
+Return      : pDst
+*****************************************************************************/ 
+void* OSMemSet(void *pDst, uOS8_t uxValue, uOSBase_t uxLen)
+{
+	return memset(pDst, uxValue, uxLen);
+}
+
+/***************************************************************************** 
+Function    : OSMemCopy 
+Description : Copy a memory area to another one, which must not overlap with it
+              unless pDst is below pSrc, by memmove() of the C library.
+Input       : pDst -- the destination.
+              pSrc -- the source.
+              uxLen -- number of bytes to be copied.
+Output      : None 
+Return      : pDst
+*****************************************************************************/ 
+void* OSMemCopy(void *pDst, const void *pSrc, uOSBase_t uxLen)
+{
+	return memmove(pDst, pSrc, uxLen);
+}
+
+/***************************************************************************** 
+Function    : OSMemMove 
+Description : Copy a memory area to another one which may overlap with it, by
+              memmove() of the C library.
+Input       : pDst -- the destination.
+              pSrc -- the source.
+              uxLen -- number of bytes to be copied.
+Output      : None 
+Return      : pDst
+*****************************************************************************/ 
+void* OSMemMove(void *pDst, const void *pSrc, uOSBase_t uxLen)
+{
+	return memmove(pDst, pSrc, uxLen);
+}
+
+#endif //(OS_MEM_WORD_COPY_ON==1)
+
+#if (OS_HEAP_ON==1)
 /***************************************************************************** 
 Function    : OSMemCalloc 
 Description : Contiguously allocates enough space for count objects that are size bytes
@@ -456,15 +683,23 @@ void* OSMemCalloc(uOSMemSize_t count, uOSMemSize_t size)
 {
 	void *pMem;
 
+	// the product must fit in uOSMemSize_t, or a smaller block would be
+	// allocated and zeroed past its end 
+	if (size != 0U && count > (uOSMemSize_t)~(uOSMemSize_t)0 / size)
+	{
+		return OS_NULL;
+	}
+
 	// allocate 'count' objects of size 'size' 
-	pMem = OSMemMalloc(count * size);
+	pMem = OSMemMalloc((uOSMemSize_t)(count * size));
 	if (pMem) 
 	{
 		// zero the memory 
-		memset(pMem, 0, count * size);
+		OSMemSet(pMem, 0U, (uOSBase_t)(count * size));
 	}
 	return pMem;
 }
+#endif //(OS_HEAP_ON==1)
 
 #ifdef __cplusplus
 }
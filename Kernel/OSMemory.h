@@ -56,11 +56,16 @@ typedef uOS32_t uOSMemSize_t;
 typedef uOS16_t uOSMemSize_t;
 #endif /* OSMEM_SIZE > 64000 */
 
+#if (OS_HEAP_ON==1)
 void  OSMemInit(void);
 void *OSMemTrim(void *pMem, uOSMemSize_t size);
 void *OSMemMalloc(uOSMemSize_t size);
 void *OSMemCalloc(uOSMemSize_t count, uOSMemSize_t size);
 void  OSMemFree(void *pMem);
+#endif //(OS_HEAP_ON==1)
+void *OSMemSet(void *pDst, uOS8_t uxValue, uOSBase_t uxLen);
+void *OSMemCopy(void *pDst, const void *pSrc, uOSBase_t uxLen);
+void *OSMemMove(void *pDst, const void *pSrc, uOSBase_t uxLen);
 
 /** Calculate memory size for an aligned buffer - returns the next highest
  * multiple of OSMEM_ALIGNMENT (e.g. OSMEM_ALIGN_SIZE(3) and
@@ -79,7 +84,7 @@ void  OSMemFree(void *pMem);
 /** Align a memory pointer to the alignment defined by OSMEM_ALIGNMENT
  * so that ADDR % OSMEM_ALIGNMENT == 0 */
 #ifndef OSMEM_ALIGN_ADDR
-#define OSMEM_ALIGN_ADDR(addr) ((void *)(((uOS32_t)(addr) + OSMEM_ALIGNMENT - 1) & ~(uOS32_t)(OSMEM_ALIGNMENT-1)))
+#define OSMEM_ALIGN_ADDR(addr) ((void *)(((uOSAddr_t)(addr) + OSMEM_ALIGNMENT - 1) & ~(uOSAddr_t)(OSMEM_ALIGNMENT-1)))
 #endif
 
 #ifdef __cplusplus
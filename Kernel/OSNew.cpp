@@ -0,0 +1,163 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#include "OSMemResource.h"
+
+#if defined(__cplusplus) && (__cplusplus >= 201703L) && (OS_CPP_NEW_ON==1)
+
+/** Replacements of the global operator new/delete, which put all C++ objects on
+ * the AIOS heap. The sized forms of delete need no extra work: OSMemFree() finds
+ * the block header by a fixed offset from the pointer, not by a lookup. */
+
+/** The plain forms must return memory aligned for any type up to this value, which
+ * can be stricter than OSMEM_ALIGNMENT(eg. 8 against 4 on Cortex-M3). They go
+ * through the over-aligned path of OSMemHeapResource then, and so must the deletes. */
+#define OSNEW_ALIGNMENT			( __STDCPP_DEFAULT_NEW_ALIGNMENT__ )
+
+static void *OSNewAlloc(std::size_t uxSize, std::size_t uxAlignment)
+{
+	void *pMem = OSMemHeapResource::Allocate(uxSize, uxAlignment);
+	if (pMem == nullptr)
+	{
+		OSMEM_BAD_ALLOC();
+	}
+	return pMem;
+}
+
+void *operator new(std::size_t uxSize)
+{
+	return OSNewAlloc(uxSize, OSNEW_ALIGNMENT);
+}
+
+void *operator new[](std::size_t uxSize)
+{
+	return OSNewAlloc(uxSize, OSNEW_ALIGNMENT);
+}
+
+void *operator new(std::size_t uxSize, const std::nothrow_t &) noexcept
+{
+	return OSMemHeapResource::Allocate(uxSize, OSNEW_ALIGNMENT);
+}
+
+void *operator new[](std::size_t uxSize, const std::nothrow_t &) noexcept
+{
+	return OSMemHeapResource::Allocate(uxSize, OSNEW_ALIGNMENT);
+}
+
+void *operator new(std::size_t uxSize, std::align_val_t uxAlignment)
+{
+	return OSNewAlloc(uxSize, static_cast<std::size_t>(uxAlignment));
+}
+
+void *operator new[](std::size_t uxSize, std::align_val_t uxAlignment)
+{
+	return OSNewAlloc(uxSize, static_cast<std::size_t>(uxAlignment));
+}
+
+void *operator new(std::size_t uxSize, std::align_val_t uxAlignment, const std::nothrow_t &) noexcept
+{
+	return OSMemHeapResource::Allocate(uxSize, static_cast<std::size_t>(uxAlignment));
+}
+
+void *operator new[](std::size_t uxSize, std::align_val_t uxAlignment, const std::nothrow_t &) noexcept
+{
+	return OSMemHeapResource::Allocate(uxSize, static_cast<std::size_t>(uxAlignment));
+}
+
+void operator delete(void *pMem) noexcept
+{
+	OSMemHeapResource::Free(pMem, OSNEW_ALIGNMENT);
+}
+
+void operator delete[](void *pMem) noexcept
+{
+	OSMemHeapResource::Free(pMem, OSNEW_ALIGNMENT);
+}
+
+void operator delete(void *pMem, std::size_t) noexcept
+{
+	OSMemHeapResource::Free(pMem, OSNEW_ALIGNMENT);
+}
+
+void operator delete[](void *pMem, std::size_t) noexcept
+{
+	OSMemHeapResource::Free(pMem, OSNEW_ALIGNMENT);
+}
+
+void operator delete(void *pMem, const std::nothrow_t &) noexcept
+{
+	OSMemHeapResource::Free(pMem, OSNEW_ALIGNMENT);
+}
+
+void operator delete[](void *pMem, const std::nothrow_t &) noexcept
+{
+	OSMemHeapResource::Free(pMem, OSNEW_ALIGNMENT);
+}
+
+void operator delete(void *pMem, std::align_val_t uxAlignment) noexcept
+{
+	OSMemHeapResource::Free(pMem, static_cast<std::size_t>(uxAlignment));
+}
+
+void operator delete[](void *pMem, std::align_val_t uxAlignment) noexcept
+{
+	OSMemHeapResource::Free(pMem, static_cast<std::size_t>(uxAlignment));
+}
+
+void operator delete(void *pMem, std::size_t, std::align_val_t uxAlignment) noexcept
+{
+	OSMemHeapResource::Free(pMem, static_cast<std::size_t>(uxAlignment));
+}
+
+void operator delete[](void *pMem, std::size_t, std::align_val_t uxAlignment) noexcept
+{
+	OSMemHeapResource::Free(pMem, static_cast<std::size_t>(uxAlignment));
+}
+
+void operator delete(void *pMem, std::align_val_t uxAlignment, const std::nothrow_t &) noexcept
+{
+	OSMemHeapResource::Free(pMem, static_cast<std::size_t>(uxAlignment));
+}
+
+void operator delete[](void *pMem, std::align_val_t uxAlignment, const std::nothrow_t &) noexcept
+{
+	OSMemHeapResource::Free(pMem, static_cast<std::size_t>(uxAlignment));
+}
+
+#endif //(OS_CPP_NEW_ON==1)
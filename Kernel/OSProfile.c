@@ -0,0 +1,312 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#include "AIOS.h"
+#include "OSProfile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (OS_PROFILE_ON==1)
+
+/** 32-bit clock of the accounting, the differences are taken modulo 2^32 and the
+ * time is folded at every tick, so it never wraps between two readings */
+#ifdef FitGetCycleCounter
+#define OSPROFILE_CLOCK()			FitGetCycleCounter()
+#else
+#define OSPROFILE_CLOCK()			((uOS32_t)OSGetCycleCount64())
+#endif
+
+static tOSTaskStats_t *gptOSProfileList = OS_NULL;		/** the registered tasks */
+static tOSTaskStats_t *gptOSProfileCurrent = OS_NULL;	/** the running task */
+static tOSTaskStats_t *gptOSProfileIdle = OS_NULL;		/** the idle task, for OSProfileGetLoad() */
+static uOS32_t guxOSProfileStamp = 0;					/** the clock when the time was folded last */
+static uOS64_t guxOSProfileTotal = 0;					/** cycles folded into the tasks so far */
+static uOS64_t guxOSProfileSnapTotal = 0;				/** guxOSProfileTotal at the last snapshot */
+static uOS64_t guxOSProfileLoadTotal = 0;				/** guxOSProfileTotal at the last OSProfileGetLoad() */
+static uOS64_t guxOSProfileLoadIdle = 0;				/** cycles of the idle task at the last OSProfileGetLoad() */
+
+/*****************************************************************************
+Function    : OSProfileAccount
+Description : Fold the cycles since the last call into the running task. The
+              time before the first switch is not counted. It is called with
+              interrupts locked.
+Input       : None
+Output      : None
+Return      : None
+*****************************************************************************/
+static void OSProfileAccount(void)
+{
+	uOS32_t uxNow;
+	uOS32_t uxDelta;
+
+	uxNow = OSPROFILE_CLOCK();
+	uxDelta = uxNow - guxOSProfileStamp;
+	guxOSProfileStamp = uxNow;
+	if (gptOSProfileCurrent != OS_NULL)
+	{
+		gptOSProfileCurrent->uxRunCycles += uxDelta;
+		guxOSProfileTotal += uxDelta;
+	}
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSProfileAdd
+Description : Clear the statistics of a task and register it, called when the task
+              is created.
+Input       : ptStats -- the statistics of the task.
+              pcName -- name of the task, used by OSProfileSnapshot().
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSProfileAdd(tOSTaskStats_t *ptStats, const sOS8_t *pcName)
+{
+	ptStats->pcName = pcName;
+	ptStats->uxRunCycles = 0;
+	ptStats->uxSnapCycles = 0;
+	ptStats->uxBlockedTicks = 0;
+	ptStats->uxBlockTick = 0;
+	ptStats->uxSwitchIns = 0;
+	ptStats->uxPreemptions = 0;
+	ptStats->uxBlocked = OS_FALSE;
+
+	OSIntLock();
+	ptStats->ptNext = gptOSProfileList;
+	gptOSProfileList = ptStats;
+	OSIntUnock();
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSProfileRemove
+Description : Unregister a task, called when it is deleted.
+Input       : ptStats -- the statistics registered by OSProfileAdd().
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSProfileRemove(tOSTaskStats_t *ptStats)
+{
+	tOSTaskStats_t **pptStats;
+
+	OSIntLock();
+	for (pptStats = &gptOSProfileList; *pptStats != OS_NULL; pptStats = &(*pptStats)->ptNext)
+	{
+		if (*pptStats == ptStats)
+		{
+			*pptStats = ptStats->ptNext;
+			break;
+		}
+	}
+	if (gptOSProfileCurrent == ptStats)
+	{
+		OSProfileAccount();
+		gptOSProfileCurrent = OS_NULL;
+	}
+	if (gptOSProfileIdle == ptStats)
+	{
+		gptOSProfileIdle = OS_NULL;
+	}
+	OSIntUnock();
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSProfileSetIdle
+Description : Tell which task is the idle task, whose running time is taken as
+              the free time of the CPU by OSProfileGetLoad().
+Input       : ptStats -- the statistics of the idle task.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSProfileSetIdle(tOSTaskStats_t *ptStats)
+{
+	OSIntLock();
+	gptOSProfileIdle = ptStats;
+	guxOSProfileLoadIdle = ptStats->uxRunCycles;
+	guxOSProfileLoadTotal = guxOSProfileTotal;
+	OSIntUnock();
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSProfileSwitch
+Description : Account a context switch. It is called by the scheduler through
+              OSPROFILE_TASK_SWITCH() with interrupts locked, and costs one read
+              of the cycle counter plus a few additions.
+Input       : ptFrom -- the task switched out, may be OS_NULL.
+              ptTo -- the task switched in, may be OS_NULL.
+              bPreempted -- OS_TRUE if ptFrom is still ready, OS_FALSE if it blocked.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSProfileSwitch(tOSTaskStats_t *ptFrom, tOSTaskStats_t *ptTo, uOSBool_t bPreempted)
+{
+	OSProfileAccount();
+
+	if (ptFrom != OS_NULL)
+	{
+		if (bPreempted == OS_TRUE)
+		{
+			ptFrom->uxPreemptions++;
+		}
+		else
+		{
+			ptFrom->uxBlocked = OS_TRUE;
+			ptFrom->uxBlockTick = OSGetTickCount();
+		}
+	}
+	if (ptTo != OS_NULL)
+	{
+		if (ptTo->uxBlocked == OS_TRUE)
+		{
+			ptTo->uxBlockedTicks += OSGetTickCount() - ptTo->uxBlockTick;
+			ptTo->uxBlocked = OS_FALSE;
+		}
+		ptTo->uxSwitchIns++;
+	}
+	gptOSProfileCurrent = ptTo;
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSProfileTick
+Description : Fold the running time of the current task, called by the tick
+              interrupt so that the 32-bit clock never wraps between two folds
+              even if a task runs for a long time without a switch.
+Input       : None
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSProfileTick(void)
+{
+	OSIntLock();
+	OSProfileAccount();
+	OSIntUnock();
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSProfileSnapshot
+Description : Copy the statistics of all registered tasks into an array, with the
+              share of the CPU of each task since the last snapshot. Interrupts
+              are locked only while the counters are copied, the divisions are
+              done after that.
+Input       : ptSnap -- the array to be filled.
+              uxMaxNum -- number of elements of ptSnap.
+Output      : ptSnap -- the statistics of the tasks.
+Return      : number of elements filled.
+*****************************************************************************/
+uOSBase_t OSProfileSnapshot(tOSTaskStatsSnap_t *ptSnap, uOSBase_t uxMaxNum)
+{
+	uOSBase_t uxNum = 0;
+	uOSBase_t uxIndex;
+	uOS64_t uxTotal;
+	tOSTaskStats_t *ptStats;
+
+	OSIntLock();
+	OSProfileAccount();
+	for (ptStats = gptOSProfileList; ptStats != OS_NULL && uxNum < uxMaxNum; ptStats = ptStats->ptNext)
+	{
+		ptSnap[uxNum].pcName = ptStats->pcName;
+		ptSnap[uxNum].uxRunCycles = ptStats->uxRunCycles;
+		ptSnap[uxNum].uxRecentCycles = ptStats->uxRunCycles - ptStats->uxSnapCycles;
+		ptSnap[uxNum].uxBlockedTicks = ptStats->uxBlockedTicks;
+		ptSnap[uxNum].uxSwitchIns = ptStats->uxSwitchIns;
+		ptSnap[uxNum].uxPreemptions = ptStats->uxPreemptions;
+		ptStats->uxSnapCycles = ptStats->uxRunCycles;
+		uxNum++;
+	}
+	uxTotal = guxOSProfileTotal - guxOSProfileSnapTotal;
+	guxOSProfileSnapTotal = guxOSProfileTotal;
+	OSIntUnock();
+
+	for (uxIndex = 0; uxIndex < uxNum; uxIndex++)
+	{
+		ptSnap[uxIndex].uxCpuPerMille = (uxTotal == 0U) ? 0U :
+			(uOS16_t)((ptSnap[uxIndex].uxRecentCycles * 1000U) / uxTotal);
+	}
+
+	return uxNum;
+}
+
+/*****************************************************************************
+Function    : OSProfileGetLoad
+Description : Get the load of the CPU since the last call, which is the time not
+              spent in the idle task set by OSProfileSetIdle().
+Input       : None
+Output      : None
+Return      : the load in 1/1000, 0 if no time has passed.
+*****************************************************************************/
+uOSBase_t OSProfileGetLoad(void)
+{
+	uOS64_t uxTotal;
+	uOS64_t uxIdle = 0;
+
+	OSIntLock();
+	OSProfileAccount();
+	uxTotal = guxOSProfileTotal - guxOSProfileLoadTotal;
+	guxOSProfileLoadTotal = guxOSProfileTotal;
+	if (gptOSProfileIdle != OS_NULL)
+	{
+		uxIdle = gptOSProfileIdle->uxRunCycles - guxOSProfileLoadIdle;
+		guxOSProfileLoadIdle = gptOSProfileIdle->uxRunCycles;
+	}
+	OSIntUnock();
+
+	if (uxTotal == 0U)
+	{
+		return 0U;
+	}
+
+	return (uOSBase_t)(1000U - (uxIdle * 1000U) / uxTotal);
+}
+
+#endif //(OS_PROFILE_ON==1)
+
+#ifdef __cplusplus
+}
+#endif
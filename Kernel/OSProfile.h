@@ -0,0 +1,101 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#ifndef __OS_PROFILE_H_
+#define __OS_PROFILE_H_
+
+#include "OSType.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (OS_PROFILE_ON==1)
+
+/** Runtime statistics of one task, meant to be embedded in its task control
+ * block. It is registered by OSProfileAdd() when the task is created and updated
+ * by the scheduler through OSPROFILE_TASK_SWITCH(). */
+typedef struct _tOSTaskStats
+{
+	struct _tOSTaskStats *ptNext;	/** next registered task */
+	const sOS8_t *pcName;			/** name of the task, may be OS_NULL */
+	uOS64_t uxRunCycles;			/** cycles spent running */
+	uOS64_t uxSnapCycles;			/** uxRunCycles at the last snapshot */
+	uOSTick_t uxBlockedTicks;		/** ticks spent blocked */
+	uOSTick_t uxBlockTick;			/** the tick when it blocked last time */
+	uOS32_t uxSwitchIns;			/** times switched in */
+	uOS32_t uxPreemptions;			/** times switched out while still ready */
+	uOS8_t uxBlocked;				/** switched out by blocking, not by preemption */
+}tOSTaskStats_t;
+
+/** One line of the result of OSProfileSnapshot() */
+typedef struct _tOSTaskStatsSnap
+{
+	const sOS8_t *pcName;			/** name of the task */
+	uOS64_t uxRunCycles;			/** cycles spent running, OSC2U() gives microseconds */
+	uOS64_t uxRecentCycles;			/** cycles spent running since the last snapshot */
+	uOSTick_t uxBlockedTicks;		/** ticks spent blocked */
+	uOS32_t uxSwitchIns;			/** times switched in */
+	uOS32_t uxPreemptions;			/** times preempted */
+	uOS16_t uxCpuPerMille;			/** share of the CPU since the last snapshot, in 1/1000 */
+}tOSTaskStatsSnap_t;
+
+void      OSProfileAdd(tOSTaskStats_t *ptStats, const sOS8_t *pcName);
+void      OSProfileRemove(tOSTaskStats_t *ptStats);
+void      OSProfileSetIdle(tOSTaskStats_t *ptStats);
+void      OSProfileSwitch(tOSTaskStats_t *ptFrom, tOSTaskStats_t *ptTo, uOSBool_t bPreempted);
+void      OSProfileTick(void);
+uOSBase_t OSProfileSnapshot(tOSTaskStatsSnap_t *ptSnap, uOSBase_t uxMaxNum);
+uOSBase_t OSProfileGetLoad(void);
+
+/** Called by the scheduler at every context switch with interrupts locked.
+ * bPreempted is OS_TRUE if ptFrom is still ready, OS_FALSE if it blocked. */
+#define OSPROFILE_TASK_SWITCH(ptFrom, ptTo, bPreempted)	OSProfileSwitch((ptFrom), (ptTo), (bPreempted))
+
+#else
+
+#define OSPROFILE_TASK_SWITCH(ptFrom, ptTo, bPreempted)
+
+#endif //(OS_PROFILE_ON==1)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__OS_PROFILE_H_
@@ -0,0 +1,305 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#include "AIOS.h"
+#include "OSStack.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (OS_STACK_CHECK_ON==1)
+
+/** Get the word which is the 'Index'th from the far end(the end which is reached last
+ * as the stack grows) of a stack. Words near the far end are painted the longest. */
+#if (OSSTACK_GROWTH < 0)
+#define OSSTACK_FAR_WORD(ptStack, Index)	((ptStack)->puxStack[(Index)])
+#else
+#define OSSTACK_FAR_WORD(ptStack, Index)	((ptStack)->puxStack[(ptStack)->uxSize - 1U - (Index)])
+#endif
+
+/** list of all painted stacks */
+static tOSStack_t *gptOSStackList = OS_NULL;
+/** the stack to be checked by the next call of OSStackCheckNext() */
+static tOSStack_t *gptOSStackCursor = OS_NULL;
+
+/*****************************************************************************
+Function    : OSStackPaint
+Description : Fill a stack with OSSTACK_FILL_VALUE and add it to the stack list.
+              It must be called when a task is created, before the initial context
+              of the task is built on the stack.
+Input       : ptStack -- the record to be initialized.
+              puxStack -- the lowest address of the stack area.
+              uxSize -- size of the stack area in words.
+              pcName -- name of the owner, used by OSStackReport().
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSStackPaint(tOSStack_t *ptStack, uOSStack_t *puxStack, uOSStack_t uxSize, const sOS8_t *pcName)
+{
+	uOSStack_t uxIndex;
+
+	for (uxIndex = 0; uxIndex < uxSize; uxIndex++)
+	{
+		puxStack[uxIndex] = OSSTACK_FILL_VALUE;
+	}
+
+	ptStack->puxStack = puxStack;
+	ptStack->uxSize = uxSize;
+	ptStack->uxFreeWords = uxSize;
+	ptStack->uxScanIndex = 0;
+	ptStack->pcName = pcName;
+
+	OSIntLock();
+	ptStack->ptNext = gptOSStackList;
+	gptOSStackList = ptStack;
+	OSIntUnock();
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSStackRemove
+Description : Remove a stack from the stack list, called when its task is deleted.
+Input       : ptStack -- the record filled by OSStackPaint().
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSStackRemove(tOSStack_t *ptStack)
+{
+	tOSStack_t **pptStack;
+
+	OSIntLock();
+	for (pptStack = &gptOSStackList; *pptStack != OS_NULL; pptStack = &(*pptStack)->ptNext)
+	{
+		if (*pptStack == ptStack)
+		{
+			*pptStack = ptStack->ptNext;
+			break;
+		}
+	}
+	if (gptOSStackCursor == ptStack)
+	{
+		gptOSStackCursor = ptStack->ptNext;
+	}
+	OSIntUnock();
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSStackCheck
+Description : Examine at most OSSTACK_CHECK_WORDS words of a stack and update its
+              high-water mark. The words between the far end and the current mark
+              are checked round by round, so a call takes constant time and a
+              deeper usage is caught within uxFreeWords/OSSTACK_CHECK_WORDS calls.
+Input       : ptStack -- the record filled by OSStackPaint().
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSStackCheck(tOSStack_t *ptStack)
+{
+	uOSBase_t uxCount;
+	uOSStack_t uxIndex;
+
+	OSIntLock();
+	uxIndex = ptStack->uxScanIndex;
+	for (uxCount = 0; uxCount < OSSTACK_CHECK_WORDS; uxCount++)
+	{
+		if (uxIndex >= ptStack->uxFreeWords)
+		{
+			// this round is through, start the next one from the far end
+			uxIndex = 0;
+			break;
+		}
+		if (OSSTACK_FAR_WORD(ptStack, uxIndex) != OSSTACK_FILL_VALUE)
+		{
+			// the stack has been used deeper than the mark
+			ptStack->uxFreeWords = uxIndex;
+			uxIndex = 0;
+			break;
+		}
+		uxIndex++;
+	}
+	ptStack->uxScanIndex = uxIndex;
+	OSIntUnock();
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSStackCheckNext
+Description : Call OSStackCheck() for the next stack in the stack list, one stack
+              per call. It is intended to be called by the idle task.
+Input       : None
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSStackCheckNext(void)
+{
+	tOSStack_t *ptStack;
+
+	OSIntLock();
+	if (gptOSStackCursor == OS_NULL)
+	{
+		gptOSStackCursor = gptOSStackList;
+	}
+	ptStack = gptOSStackCursor;
+	if (ptStack != OS_NULL)
+	{
+		gptOSStackCursor = ptStack->ptNext;
+	}
+	OSIntUnock();
+
+	if (ptStack != OS_NULL)
+	{
+		OSStackCheck(ptStack);
+	}
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSStackMargin
+Description : Add a margin to a stack usage, the result is not less than
+              OSMINIMAL_STACK_SIZE.
+Input       : uxUsed -- the max usage of a stack in words.
+              uxMarginPercent -- the margin in percent of uxUsed.
+Output      : None
+Return      : the suggested stack size in words.
+*****************************************************************************/
+static uOSStack_t OSStackMargin(uOSStack_t uxUsed, uOSBase_t uxMarginPercent)
+{
+	uOSStack_t uxSuggested;
+
+	uxSuggested = uxUsed + (uOSStack_t)((uxUsed * uxMarginPercent + 99U) / 100U);
+	if (uxSuggested < OSMINIMAL_STACK_SIZE)
+	{
+		uxSuggested = OSMINIMAL_STACK_SIZE;
+	}
+
+	return uxSuggested;
+}
+
+/*****************************************************************************
+Function    : OSStackScan
+Description : Scan a stack from the far end by a full round of OSStackCheck() and
+              update its high-water mark. Interrupts are locked for no more than
+              OSSTACK_CHECK_WORDS words at a time, but the whole call costs
+              O(uxFreeWords), so use it for diagnostics only.
+Input       : ptStack -- the record filled by OSStackPaint().
+Output      : None
+Return      : the min number of free words of the stack.
+*****************************************************************************/
+uOSStack_t OSStackScan(tOSStack_t *ptStack)
+{
+	// start a new round from the far end
+	OSIntLock();
+	ptStack->uxScanIndex = 0;
+	OSIntUnock();
+
+	// the round is through when the scan index goes back to the far end
+	do
+	{
+		OSStackCheck(ptStack);
+	} while (ptStack->uxScanIndex != 0U);
+
+	return ptStack->uxFreeWords;
+}
+
+/*****************************************************************************
+Function    : OSStackSuggestSize
+Description : Suggest a stack size for the owner of a stack: the max usage so far
+              plus a margin, but not less than OSMINIMAL_STACK_SIZE.
+Input       : ptStack -- the record filled by OSStackPaint().
+              uxMarginPercent -- the margin in percent of the max usage.
+Output      : None
+Return      : the suggested stack size in words.
+*****************************************************************************/
+uOSStack_t OSStackSuggestSize(tOSStack_t *ptStack, uOSBase_t uxMarginPercent)
+{
+	return OSStackMargin(ptStack->uxSize - OSStackScan(ptStack), uxMarginPercent);
+}
+
+/*****************************************************************************
+Function    : OSStackReport
+Description : Fill the usage of all painted stacks into an array, with suggested
+              sizes using OSSTACK_MARGIN_PERCENT. Every stack is scanned by
+              OSStackScan(), so the whole call takes long.
+Input       : ptReport -- the array to be filled.
+              uxMaxNum -- number of elements of ptReport.
+Output      : ptReport -- the usage of the stacks.
+Return      : number of elements filled.
+*****************************************************************************/
+uOSBase_t OSStackReport(tOSStackReport_t *ptReport, uOSBase_t uxMaxNum)
+{
+	uOSBase_t uxNum;
+	uOSBase_t uxIndex;
+	tOSStack_t *ptStack;
+
+	for (uxNum = 0; uxNum < uxMaxNum; uxNum++)
+	{
+		// find the uxNum'th stack again, the list may have changed meanwhile
+		OSIntLock();
+		ptStack = gptOSStackList;
+		for (uxIndex = 0; ptStack != OS_NULL && uxIndex < uxNum; uxIndex++)
+		{
+			ptStack = ptStack->ptNext;
+		}
+		OSIntUnock();
+
+		if (ptStack == OS_NULL)
+		{
+			break;
+		}
+
+		ptReport[uxNum].pcName = ptStack->pcName;
+		ptReport[uxNum].uxSize = ptStack->uxSize;
+		ptReport[uxNum].uxUsed = ptStack->uxSize - OSStackScan(ptStack);
+		ptReport[uxNum].uxSuggested = OSStackMargin(ptReport[uxNum].uxUsed, OSSTACK_MARGIN_PERCENT);
+	}
+
+	return uxNum;
+}
+
+#endif //(OS_STACK_CHECK_ON==1)
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,99 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#ifndef __OS_STACK_H_
+#define __OS_STACK_H_
+
+#include "OSType.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (OS_STACK_CHECK_ON==1)
+
+/** Stack usage record of one task. It is filled by OSStackPaint() when the task is
+ * created (before the initial context is built on the stack) and linked into the
+ * list which is walked by OSStackCheckNext() and OSStackReport(). */
+typedef struct _tOSStack
+{
+	struct _tOSStack *ptNext;	/** next registered stack */
+	uOSStack_t *puxStack;		/** the lowest address of the stack area */
+	uOSStack_t uxSize;			/** size of the stack area in words */
+	uOSStack_t uxFreeWords;		/** words never touched since painting(high-water mark) */
+	uOSStack_t uxScanIndex;		/** next word to be examined by OSStackCheck() */
+	const sOS8_t *pcName;		/** name of the owner, may be OS_NULL */
+}tOSStack_t;
+
+/** One line of the result of OSStackReport(), all sizes in words */
+typedef struct _tOSStackReport
+{
+	const sOS8_t *pcName;		/** name of the owner */
+	uOSStack_t uxSize;			/** current size of the stack */
+	uOSStack_t uxUsed;			/** max words used so far */
+	uOSStack_t uxSuggested;		/** suggested size: uxUsed plus OSSTACK_MARGIN_PERCENT */
+}tOSStackReport_t;
+
+void       OSStackPaint(tOSStack_t *ptStack, uOSStack_t *puxStack, uOSStack_t uxSize, const sOS8_t *pcName);
+void       OSStackRemove(tOSStack_t *ptStack);
+void       OSStackCheck(tOSStack_t *ptStack);
+void       OSStackCheckNext(void);
+uOSStack_t OSStackScan(tOSStack_t *ptStack);
+uOSStack_t OSStackSuggestSize(tOSStack_t *ptStack, uOSBase_t uxMarginPercent);
+uOSBase_t  OSStackReport(tOSStackReport_t *ptReport, uOSBase_t uxMaxNum);
+
+/** The high-water mark of a stack: the min number of free words ever seen.
+ * It only reads the value maintained by OSStackCheck(), so it costs O(1). */
+#define OSStackGetHighWaterMark(ptStack)	((ptStack)->uxFreeWords)
+
+/** Declare a stack area of Words words and its usage record, reserved at link
+ * time. OSSTACK_PAINT() paints it before the task is built on it. */
+#define OSSTACK_DEFINE(Name, Words)		static uOSStack_t gauxOSStack_##Name[(Words)]; \
+										tOSStack_t Name
+
+#define OSSTACK_PAINT(Name, pcName)		OSStackPaint(&(Name), gauxOSStack_##Name, \
+										(uOSStack_t)(sizeof(gauxOSStack_##Name)/sizeof(uOSStack_t)), (pcName))
+
+#endif //(OS_STACK_CHECK_ON==1)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__OS_STACK_H_
@@ -0,0 +1,204 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#include "AIOS.h"
+#include "OSTime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** the 64-bit tick count, kept as two words so that the tick interrupt only
+ * writes 32-bit values: the high word changes only after the low word wraps */
+static volatile uOS32_t guxOSTickLow = 0;
+static volatile uOS32_t guxOSTickHigh = 0;
+
+#ifdef FitGetCycleCounter
+/** the 32-bit cycle counter read last time and the number of its wraps */
+static uOS32_t guxOSCycleLast = 0;
+static uOS32_t guxOSCycleHigh = 0;
+#endif
+
+/*****************************************************************************
+Function    : OSTimeTickIncrement
+Description : Advance the tick count by one. It is called by the tick interrupt
+              only, which also keeps the 64-bit cycle count extended.
+Input       : None
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSTimeTickIncrement(void)
+{
+	uOS32_t uxTickLow;
+
+	uxTickLow = guxOSTickLow + 1U;
+	guxOSTickLow = uxTickLow;
+	if (uxTickLow == 0U)
+	{
+		guxOSTickHigh = guxOSTickHigh + 1U;
+	}
+#ifdef FitGetCycleCounter
+	// the 32-bit cycle counter wraps in seconds, read it once per tick to catch every wrap
+	(void)OSGetCycleCount64();
+#endif
+#if (OS_PROFILE_ON==1)
+	OSProfileTick();
+#endif
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSGetTickCount
+Description : Get the low 32 bits of the tick count.
+Input       : None
+Output      : None
+Return      : the tick count since the scheduler was started.
+*****************************************************************************/
+uOSTick_t OSGetTickCount(void)
+{
+	return (uOSTick_t)guxOSTickLow;
+}
+
+/*****************************************************************************
+Function    : OSGetTickCount64
+Description : Get the 64-bit monotonic tick count, which never wraps in practice.
+              The two words are read without locking: if the high word changed
+              while the low word was read, the read is simply done again.
+Input       : None
+Output      : None
+Return      : the tick count since the scheduler was started.
+*****************************************************************************/
+uOSTick64_t OSGetTickCount64(void)
+{
+	uOS32_t uxHigh;
+	uOS32_t uxLow;
+
+	do
+	{
+		uxHigh = guxOSTickHigh;
+		uxLow = guxOSTickLow;
+	} while (uxHigh != guxOSTickHigh);
+
+	return ((uOSTick64_t)uxHigh << 32) | uxLow;
+}
+
+/*****************************************************************************
+Function    : OSGetCycleCount64
+Description : Get a 64-bit high-resolution timestamp in CPU cycles(OSCPU_CLOCK_HZ),
+              for sub-tick timeouts and profiling. OSC2U() converts it to
+              microseconds. Without a cycle counter in the port, the resolution
+              falls back to one tick.
+Input       : None
+Output      : None
+Return      : CPU cycles since the cycle counter was started.
+*****************************************************************************/
+uOS64_t OSGetCycleCount64(void)
+{
+#ifdef FitGetCycleCounter
+	uOS32_t uxCycle;
+	uOS32_t uxHigh;
+
+	OSIntLock();
+	uxCycle = FitGetCycleCounter();
+	if (uxCycle < guxOSCycleLast)
+	{
+		guxOSCycleHigh++;
+	}
+	guxOSCycleLast = uxCycle;
+	uxHigh = guxOSCycleHigh;
+	OSIntUnock();
+
+	return ((uOS64_t)uxHigh << 32) | uxCycle;
+#else
+	return OSGetTickCount64() * (OSCPU_CLOCK_HZ / OSTICK_RATE_VALUE);
+#endif
+}
+
+/*****************************************************************************
+Function    : OSTimeOutSet
+Description : Record the time of entering a blocking call, for OSTimeOutCheck().
+Input       : ptTimeOut -- the timeout record.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSTimeOutSet(tOSTimeOut_t *ptTimeOut)
+{
+	ptTimeOut->uxTimeOnEntering = OSGetTickCount64();
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSTimeOutCheck
+Description : Check if a blocking call has timed out, and update the ticks left.
+              As the time base is 64 bits, no overflow bookkeeping is needed.
+Input       : ptTimeOut -- the timeout record set by OSTimeOutSet().
+              puxTicksToWait -- the ticks left to wait, OSPEND_FOREVER_VALUE
+                                never times out.
+Output      : puxTicksToWait -- the ticks left to wait after this check.
+Return      : OS_TRUE if timed out, or OS_FALSE.
+*****************************************************************************/
+uOSBool_t OSTimeOutCheck(tOSTimeOut_t *ptTimeOut, uOSTick_t *puxTicksToWait)
+{
+	uOSTick64_t uxTimeNow;
+	uOSTick64_t uxElapsed;
+
+	if (*puxTicksToWait == OSPEND_FOREVER_VALUE)
+	{
+		return OS_FALSE;
+	}
+
+	uxTimeNow = OSGetTickCount64();
+	uxElapsed = uxTimeNow - ptTimeOut->uxTimeOnEntering;
+	if (uxElapsed >= *puxTicksToWait)
+	{
+		*puxTicksToWait = 0;
+		return OS_TRUE;
+	}
+
+	*puxTicksToWait -= (uOSTick_t)uxElapsed;
+	ptTimeOut->uxTimeOnEntering = uxTimeNow;
+
+	return OS_FALSE;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -54,10 +54,11 @@ typedef void (*OSTaskFunction_t)( void * );
 typedef void (*OSTimerFunction_t)(void * );
 typedef void (*OSCallbackFunction_t)( void *, uOS32_t );
 
+typedef uOS64_t uOSTick64_t;
+
 typedef struct tTIME_OUT
 {
-	sOSBase_t xOverflowCount;
-	uOSTick_t uxTimeOnEntering;
+	uOSTick64_t uxTimeOnEntering;
 } tOSTimeOut_t;
 
 typedef enum {OS_FALSE = 0, OS_TRUE = !OS_FALSE} uOSBool_t;
@@ -68,10 +69,11 @@ typedef enum {OS_SUCESS = 0, OS_ERROR = !OS_SUCESS} uOSStatus_t;
 #define 	OS_FAIL					( OS_FALSE )
 
 #ifndef SETOS_TICK_RATE_HZ
-  #define	OSTICK_RATE_HZ			( ( uOSTick_t )1000 )
+  #define	OSTICK_RATE_VALUE		( 1000UL )
 #else
-  #define	OSTICK_RATE_HZ			( ( uOSTick_t ) SETOS_TICK_RATE_HZ )
+  #define	OSTICK_RATE_VALUE		( SETOS_TICK_RATE_HZ )
 #endif
+#define 	OSTICK_RATE_HZ			( ( uOSTick_t ) OSTICK_RATE_VALUE )
 
 #define 	OSTICKS_PER_MS			( ( uOSTick_t ) OSTICK_RATE_HZ/1000 )
 
@@ -102,6 +104,29 @@ typedef enum {OS_SUCESS = 0, OS_ERROR = !OS_SUCESS} uOSStatus_t;
 #define 	OSLOWEAST_PRIORITY		( 0 )
 #define		OSHIGHEAST_PRIORITY		( OSTASK_MAX_PRIORITY )
 
+// Allocate the kernel objects statically only, with the OSXXX_DEFINE macros.
+// The OSXXXCreate functions are compiled out and the heap is off by default.
+#ifndef SETOS_STATIC_ALLOCATION
+  #define	OS_STATIC_ALLOCATION_ON	( 0 )
+#else
+  #define	OS_STATIC_ALLOCATION_ON	( SETOS_STATIC_ALLOCATION )
+#endif
+
+// Use the heap(OSMemMalloc, OSMemFree, ...) or not
+#ifndef SETOS_USE_HEAP
+  #if (OS_STATIC_ALLOCATION_ON==1)
+    #define	OS_HEAP_ON				( 0 )
+  #else
+    #define	OS_HEAP_ON				( 1 )
+  #endif
+#else
+  #define	OS_HEAP_ON				( SETOS_USE_HEAP )
+#endif
+
+#if (OS_STATIC_ALLOCATION_ON==0) && (OS_HEAP_ON==0)
+  #error "The dynamic allocation of kernel objects needs the heap, set SETOS_STATIC_ALLOCATION to 1"
+#endif
+
 // The total heap size of the AIOS
 #ifndef SETOS_TOTAL_HEAP_SIZE
   #define	OSTOTAL_HEAP_SIZE		( 512 )
@@ -109,6 +134,15 @@ typedef enum {OS_SUCESS = 0, OS_ERROR = !OS_SUCESS} uOSStatus_t;
   #define	OSTOTAL_HEAP_SIZE		( SETOS_TOTAL_HEAP_SIZE )
 #endif
 
+// Use the word-wide loops of OSMemSet/OSMemCopy/OSMemMove instead of the C library.
+// Turn it on only for a C library which copies byte by byte, and only if
+// bench/OSMemBench.c shows a win on the port.
+#ifndef SETOS_USE_MEM_WORD_COPY
+  #define	OS_MEM_WORD_COPY_ON		( 0 )
+#else
+  #define	OS_MEM_WORD_COPY_ON		( SETOS_USE_MEM_WORD_COPY )
+#endif
+
 // Mini stack size of a task(Idle task or Monitor task)
 #ifndef SETOS_MINIMAL_STACK_SIZE
   #define	OSMINIMAL_STACK_SIZE	( 32 )
@@ -116,6 +150,43 @@ typedef enum {OS_SUCESS = 0, OS_ERROR = !OS_SUCESS} uOSStatus_t;
   #define	OSMINIMAL_STACK_SIZE	( SETOS_MINIMAL_STACK_SIZE )
 #endif
 
+// Use arena(region) allocator or not
+#ifndef SETOS_USE_MEMARENA
+  #define	OS_MEMARENA_ON			( 1 )
+#else
+  #define	OS_MEMARENA_ON			( SETOS_USE_MEMARENA )
+#endif
+
+// Use stack painting and high-water measurement or not
+#ifndef SETOS_USE_STACK_CHECK
+  #define	OS_STACK_CHECK_ON		( 1 )
+#else
+  #define	OS_STACK_CHECK_ON		( SETOS_USE_STACK_CHECK )
+#endif
+
+#if (OS_STACK_CHECK_ON==1)
+// The pattern painted into a stack when a task is created
+#ifndef SETOS_STACK_FILL_VALUE
+  #define	OSSTACK_FILL_VALUE		( ( uOSStack_t ) 0xA5A5A5A5UL )
+#else
+  #define	OSSTACK_FILL_VALUE		( ( uOSStack_t ) SETOS_STACK_FILL_VALUE )
+#endif
+
+// Max stack words examined by one call of OSStackCheck()
+#ifndef SETOS_STACK_CHECK_WORDS
+  #define	OSSTACK_CHECK_WORDS		( 8 )
+#else
+  #define	OSSTACK_CHECK_WORDS		( SETOS_STACK_CHECK_WORDS )
+#endif
+
+// Safety margin(in percent of the measured usage) added to a suggested stack size
+#ifndef SETOS_STACK_MARGIN_PERCENT
+  #define	OSSTACK_MARGIN_PERCENT	( 25 )
+#else
+  #define	OSSTACK_MARGIN_PERCENT	( SETOS_STACK_MARGIN_PERCENT )
+#endif
+#endif //(OS_STACK_CHECK_ON==1)
+
 // Length of name(eg. task name, semaphore name, MsgQ name, Mutex name)
 #ifndef SETOS_MAX_NAME_LEN
   #define	OSNAME_MAX_LEN			( 10 )
@@ -175,8 +246,115 @@ typedef enum {OS_SUCESS = 0, OS_ERROR = !OS_SUCESS} uOSStatus_t;
 #endif
 #endif //(OS_MSGQ_ON==1)
 
-// Milliseconds to OS Ticks
-#define OSM2T(X) 					((uOSTick_t)((X)*(OSTICK_RATE_HZ/1000.0)))
+// Use work queue(deferred callbacks from ISRs) or not
+#ifndef SETOS_USE_WORKQ
+  #define	OS_WORKQ_ON				( 1 )
+#else
+  #define	OS_WORKQ_ON				( SETOS_USE_WORKQ )
+#endif
+
+#if (OS_WORKQ_ON==1)
+// Default priority of the work queue worker tasks
+#ifndef SETOS_WORKQ_TASK_PRIORITY
+  #if (OS_MSGQ_ON==1)
+    #define	OSWORKQ_TASK_PRIO		( OSCALLBACK_TASK_PRIO )
+  #else
+    #define	OSWORKQ_TASK_PRIO		( OSHIGHEAST_PRIORITY - 1 )
+  #endif
+#else
+  #define	OSWORKQ_TASK_PRIO		( SETOS_WORKQ_TASK_PRIORITY )
+#endif
+
+// Max work items run by a worker task in one batch
+#ifndef SETOS_WORKQ_BATCH_SIZE
+  #define	OSWORKQ_BATCH_SIZE		( 8 )
+#else
+  #define	OSWORKQ_BATCH_SIZE		( SETOS_WORKQ_BATCH_SIZE )
+#endif
+#endif //(OS_WORKQ_ON==1)
+
+// Use reference-counted buffer chains(zero-copy I/O buffers) or not
+#ifndef SETOS_USE_BUF
+  #define	OS_BUF_ON				( OS_HEAP_ON )
+#else
+  #define	OS_BUF_ON				( SETOS_USE_BUF )
+#endif
+
+#if (OS_BUF_ON==1) && (OS_HEAP_ON==0)
+  #error "The buffer chains are allocated from the heap, set SETOS_USE_HEAP to 1"
+#endif
+
+// Use stackless coroutines or not
+#ifndef SETOS_USE_COROUTINE
+  #define	OS_COROUTINE_ON			( 1 )
+#else
+  #define	OS_COROUTINE_ON			( SETOS_USE_COROUTINE )
+#endif
+
+// Use per-task runtime accounting(cycles, switches, blocked time) or not
+#ifndef SETOS_USE_PROFILE
+  #define	OS_PROFILE_ON			( 1 )
+#else
+  #define	OS_PROFILE_ON			( SETOS_USE_PROFILE )
+#endif
+
+// Replace the global operator new/delete of C++ by the OS heap or not(OSNew.cpp)
+#ifndef SETOS_USE_CPP_NEW
+  #define	OS_CPP_NEW_ON			( 0 )
+#else
+  #define	OS_CPP_NEW_ON			( SETOS_USE_CPP_NEW )
+#endif
+
+#if (OS_CPP_NEW_ON==1) && (OS_HEAP_ON==0)
+  #error "The operator new/delete of OSNew.cpp use the heap, set SETOS_USE_HEAP to 1"
+#endif
+
+// CPU core clock, the rate of the cycle counter
+#ifndef SETOS_CPU_CLOCK_HZ
+  #define	OSCPU_CLOCK_HZ			( 72000000UL )
+#else
+  #define	OSCPU_CLOCK_HZ			( SETOS_CPU_CLOCK_HZ )
+#endif
+
+// Milliseconds to OS Ticks, integer only and folded at compile time as far as possible.
+// For a tick rate which neither divides nor is a multiple of 1000, the fraction of
+// OSTICK_RATE_VALUE/1000 is applied as a 32.32 fixed-point multiply(one 32x32->64 mul),
+// which is exact for X below about 4.29 million ms.
+#if ((OSTICK_RATE_VALUE % 1000UL) == 0)
+#define OSM2T(X) 					((uOSTick_t)((uOSTick_t)(X)*(OSTICK_RATE_VALUE/1000UL)))
+#elif ((1000UL % OSTICK_RATE_VALUE) == 0)
+#define OSM2T(X) 					((uOSTick_t)((uOSTick_t)(X)/(1000UL/OSTICK_RATE_VALUE)))
+#else
+#define OSM2T_FRACTION				((((uOS64_t)(OSTICK_RATE_VALUE%1000UL))<<32)/1000UL + 1U)
+#define OSM2T(X) 					((uOSTick_t)((uOSTick_t)(X)*(OSTICK_RATE_VALUE/1000UL) + \
+										(uOSTick_t)(((uOS64_t)(uOSTick_t)(X)*OSM2T_FRACTION)>>32)))
+#endif
+// OS Ticks to milliseconds
+#if ((1000UL % OSTICK_RATE_VALUE) == 0)
+#define OST2M(X) 					((uOSTick_t)((uOSTick_t)(X)*(1000UL/OSTICK_RATE_VALUE)))
+#elif ((OSTICK_RATE_VALUE % 1000UL) == 0)
+#define OST2M(X) 					((uOSTick_t)((uOSTick_t)(X)/(OSTICK_RATE_VALUE/1000UL)))
+#else
+// the fraction of 1000/OSTICK_RATE_VALUE as in OSM2T(), exact for X below
+// 2^32/OSTICK_RATE_VALUE ticks(about 68 minutes at 1024 Hz) and at most 1 ms over beyond
+#define OST2M_FRACTION				((((uOS64_t)(1000UL%OSTICK_RATE_VALUE))<<32)/OSTICK_RATE_VALUE + 1U)
+#define OST2M(X) 					((uOSTick_t)((uOSTick_t)(X)*(1000UL/OSTICK_RATE_VALUE) + \
+										(uOSTick_t)(((uOS64_t)(uOSTick_t)(X)*OST2M_FRACTION)>>32)))
+#endif
+// CPU cycles to microseconds, for a count of up to 64 bits. The ratio 1000000/OSCPU_CLOCK_HZ
+// is applied as a 32.32 fixed-point multiply over the two 32-bit halves of X(two 32x32->64
+// muls, no 64-bit division). The result is never below the exact value and at most
+// 1 + X/2^32 us above it, ie. within 1 us for X below 2^32 cycles.
+#if (OSCPU_CLOCK_HZ == 1000000UL)
+#define OSC2U(X) 					((uOS64_t)(X))
+#elif (OSCPU_CLOCK_HZ > 1000000UL)
+#define OSC2U_FRACTION				((((uOS64_t)1000000UL)<<32)/OSCPU_CLOCK_HZ + 1U)
+#define OSC2U(X) 					((uOS64_t)(uOS32_t)((uOS64_t)(X)>>32)*OSC2U_FRACTION + \
+										(((uOS64_t)(uOS32_t)(X)*OSC2U_FRACTION)>>32))
+#else
+// a clock below 1 MHz takes a 64-bit division
+#define OSC2U(X) 					(((uOS64_t)(X)*1000000UL)/OSCPU_CLOCK_HZ)
+#endif
 // Frequency to OS Ticks
 #define OSF2T(X) 					((uOSTick_t)((OSTICK_RATE_HZ/(X))))
 
@@ -0,0 +1,390 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#include "AIOS.h"
+#include "OSWorkQ.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (OS_WORKQ_ON==1)
+
+/*****************************************************************************
+Function    : OSWorkQPush
+Description : Put a work into the ring without any lock. A free slot is claimed by
+              moving uxPostPos forward with a compare-and-swap, which only has to
+              be retried when a nested interrupt posted at the same time, then the
+              slot is filled and published by its sequence.
+Input       : ptWorkQ -- the work queue.
+              pfnCallback, pvArg, uxValue -- the work.
+              ptItem -- the coalesced item, or OS_NULL.
+Output      : None
+Return      : OS_SUCESS, or OS_ERROR if the ring is full.
+*****************************************************************************/
+static uOSStatus_t OSWorkQPush(tOSWorkQ_t *ptWorkQ, OSCallbackFunction_t pfnCallback, void *pvArg, uOS32_t uxValue, tOSWorkItem_t *ptItem)
+{
+	tOSWorkCell_t *ptCell;
+	uOS32_t uxPos;
+	sOS32_t sxDiff;
+	sOS32_t sxBacklog;
+
+	uxPos = ptWorkQ->uxPostPos;
+	for (;;)
+	{
+		ptCell = &ptWorkQ->ptCells[uxPos & ptWorkQ->uxMask];
+		sxDiff = (sOS32_t)(ptCell->uxSequence - uxPos);
+		if (sxDiff == 0)
+		{
+			if (FitCompareAndSwap(&ptWorkQ->uxPostPos, uxPos, uxPos + 1U))
+			{
+				break;
+			}
+		}
+		else if (sxDiff < 0)
+		{
+			// the slot has not been run yet: the ring is full
+			return OS_ERROR;
+		}
+		uxPos = ptWorkQ->uxPostPos;
+	}
+
+	ptCell->pfnCallback = pfnCallback;
+	ptCell->pvArg = pvArg;
+	ptCell->uxValue = uxValue;
+	ptCell->ptItem = ptItem;
+	FitMemoryBarrier();
+	ptCell->uxSequence = uxPos + 1U;
+	FitMemoryBarrier();
+
+	// the post which makes the queue non-empty wakes up a worker task, and so does
+	// every post which starts another batch of OSWORKQ_BATCH_SIZE works, so that
+	// one more worker task is woken up for every batch waiting. A negative backlog
+	// means this work has been taken already.
+	sxBacklog = (sOS32_t)(uxPos - ptWorkQ->uxRunPos);
+	if (sxBacklog >= 0 && ((uOS32_t)sxBacklog % OSWORKQ_BATCH_SIZE) == 0U && ptWorkQ->pfnWakeup != OS_NULL)
+	{
+		ptWorkQ->pfnWakeup(ptWorkQ->pvHookArg);
+	}
+
+	return OS_SUCESS;
+}
+
+/*****************************************************************************
+Function    : OSWorkQPop
+Description : Take the oldest work out of the ring without any lock.
+Input       : ptWorkQ -- the work queue.
+Output      : ptWork -- the work taken out.
+Return      : OS_SUCESS, or OS_ERROR if the ring is empty.
+*****************************************************************************/
+static uOSStatus_t OSWorkQPop(tOSWorkQ_t *ptWorkQ, tOSWorkCell_t *ptWork)
+{
+	tOSWorkCell_t *ptCell;
+	uOS32_t uxPos;
+	sOS32_t sxDiff;
+
+	uxPos = ptWorkQ->uxRunPos;
+	for (;;)
+	{
+		ptCell = &ptWorkQ->ptCells[uxPos & ptWorkQ->uxMask];
+		sxDiff = (sOS32_t)(ptCell->uxSequence - (uxPos + 1U));
+		if (sxDiff == 0)
+		{
+			if (FitCompareAndSwap(&ptWorkQ->uxRunPos, uxPos, uxPos + 1U))
+			{
+				break;
+			}
+		}
+		else if (sxDiff < 0)
+		{
+			// the slot has not been published yet: the ring is empty
+			return OS_ERROR;
+		}
+		uxPos = ptWorkQ->uxRunPos;
+	}
+
+	ptWork->pfnCallback = ptCell->pfnCallback;
+	ptWork->pvArg = ptCell->pvArg;
+	ptWork->uxValue = ptCell->uxValue;
+	ptWork->ptItem = ptCell->ptItem;
+	FitMemoryBarrier();
+	// free the slot for the post one round later
+	ptCell->uxSequence = uxPos + ptWorkQ->uxMask + 1U;
+
+	return OS_SUCESS;
+}
+
+/*****************************************************************************
+Function    : OSWorkQInit
+Description : Initialize a work queue on a given ring.
+Input       : ptWorkQ -- the work queue.
+              ptCells -- the ring.
+              uxLength -- number of cells of the ring, a power of 2 and at least 2.
+              uxPriority -- priority of the worker tasks, eg. OSWORKQ_TASK_PRIO.
+Output      : None
+Return      : OS_SUCESS, or OS_ERROR if uxLength is not a valid length.
+*****************************************************************************/
+uOSStatus_t OSWorkQInit(tOSWorkQ_t *ptWorkQ, tOSWorkCell_t *ptCells, uOS32_t uxLength, uOSBase_t uxPriority)
+{
+	uOS32_t uxIndex;
+
+	// the sequence numbers need at least two cells and a mask of the positions
+	if (uxLength < 2U || (uxLength & (uxLength - 1U)) != 0U)
+	{
+		return OS_ERROR;
+	}
+
+	for (uxIndex = 0; uxIndex < uxLength; uxIndex++)
+	{
+		ptCells[uxIndex].uxSequence = uxIndex;
+	}
+	ptWorkQ->ptCells = ptCells;
+	ptWorkQ->uxMask = uxLength - 1U;
+	ptWorkQ->uxPostPos = 0;
+	ptWorkQ->uxRunPos = 0;
+	ptWorkQ->uxPriority = uxPriority;
+	ptWorkQ->pfnWakeup = OS_NULL;
+	ptWorkQ->pfnWait = OS_NULL;
+	ptWorkQ->pvHookArg = OS_NULL;
+
+	return OS_SUCESS;
+}
+
+#if (OS_STATIC_ALLOCATION_ON==0)
+/*****************************************************************************
+Function    : OSWorkQCreate
+Description : Allocate a work queue and its ring from the heap and initialize it.
+Input       : uxLength -- min number of works the ring holds, rounded up to a
+                          power of 2.
+              uxPriority -- priority of the worker tasks, eg. OSWORKQ_TASK_PRIO.
+Output      : None
+Return      : the work queue, or OS_NULL if there is no enough memory.
+*****************************************************************************/
+tOSWorkQ_t *OSWorkQCreate(uOS32_t uxLength, uOSBase_t uxPriority)
+{
+	tOSWorkQ_t *ptWorkQ;
+	uOS32_t uxRound = 2U;
+	uOS32_t uxSize;
+
+	while (uxRound < uxLength)
+	{
+		uxRound <<= 1;
+	}
+	uxSize = OSMEM_ALIGN_SIZE(sizeof(tOSWorkQ_t)) + uxRound * sizeof(tOSWorkCell_t);
+	if ((uOS32_t)(uOSMemSize_t)uxSize != uxSize)
+	{
+		return OS_NULL;
+	}
+
+	ptWorkQ = (tOSWorkQ_t *)OSMemMalloc((uOSMemSize_t)uxSize);
+	if (ptWorkQ != OS_NULL)
+	{
+		(void)OSWorkQInit(ptWorkQ, (tOSWorkCell_t *)(void *)((uOS8_t *)ptWorkQ + OSMEM_ALIGN_SIZE(sizeof(tOSWorkQ_t))), uxRound, uxPriority);
+	}
+
+	return ptWorkQ;
+}
+#endif //(OS_STATIC_ALLOCATION_ON==0)
+
+/*****************************************************************************
+Function    : OSWorkQSetHook
+Description : Set the hooks a work queue uses to wake up and block its worker
+              tasks, eg. giving and taking a counting semaphore. pfnWakeup is
+              called once for every OSWORKQ_BATCH_SIZE works queued, so a burst
+              wakes up as many worker tasks as it has batches. Without pfnWait,
+              the worker tasks keep polling the queue.
+Input       : ptWorkQ -- the work queue.
+              pfnWakeup -- called from OSWorkQPost(), maybe in an interrupt.
+              pfnWait -- called by OSWorkQTask() when the queue is empty.
+              pvHookArg -- the parameter of the hooks.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSWorkQSetHook(tOSWorkQ_t *ptWorkQ, OSWorkQHook_t pfnWakeup, OSWorkQHook_t pfnWait, void *pvHookArg)
+{
+	ptWorkQ->pvHookArg = pvHookArg;
+	ptWorkQ->pfnWait = pfnWait;
+	ptWorkQ->pfnWakeup = pfnWakeup;
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSWorkItemInit
+Description : Initialize a work item for OSWorkQPostItem().
+Input       : ptItem -- the work item.
+              pfnCallback -- the callback to be run by a worker task.
+              pvArg -- the first parameter of the callback.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSWorkItemInit(tOSWorkItem_t *ptItem, OSCallbackFunction_t pfnCallback, void *pvArg)
+{
+	ptItem->pfnCallback = pfnCallback;
+	ptItem->pvArg = pvArg;
+	ptItem->uxState = 0;
+
+	return;
+}
+
+/*****************************************************************************
+Function    : OSWorkQPost
+Description : Post a callback to be run by a worker task. It never blocks and can
+              be called from interrupts.
+Input       : ptWorkQ -- the work queue.
+              pfnCallback -- the callback.
+              pvArg, uxValue -- the parameters of the callback.
+Output      : None
+Return      : OS_SUCESS, or OS_ERROR if the queue is full.
+*****************************************************************************/
+uOSStatus_t OSWorkQPost(tOSWorkQ_t *ptWorkQ, OSCallbackFunction_t pfnCallback, void *pvArg, uOS32_t uxValue)
+{
+	return OSWorkQPush(ptWorkQ, pfnCallback, pvArg, uxValue, OS_NULL);
+}
+
+/*****************************************************************************
+Function    : OSWorkQPostItem
+Description : Post a work item to be run by a worker task. If the item is still
+              queued, the post is coalesced into it: uxValue is ORed into the value
+              the callback will get and nothing is queued. It never blocks and can
+              be called from interrupts.
+Input       : ptWorkQ -- the work queue.
+              ptItem -- the work item.
+              uxValue -- bits(0~30) for the callback.
+Output      : None
+Return      : OS_SUCESS, or OS_ERROR if the queue is full. The value is kept in
+              the item for the next post then.
+*****************************************************************************/
+uOSStatus_t OSWorkQPostItem(tOSWorkQ_t *ptWorkQ, tOSWorkItem_t *ptItem, uOS32_t uxValue)
+{
+	uOS32_t uxState;
+
+	do
+	{
+		uxState = ptItem->uxState;
+	} while (!FitCompareAndSwap(&ptItem->uxState, uxState, uxState | (uxValue & ~OSWORKITEM_PENDING) | OSWORKITEM_PENDING));
+
+	if ((uxState & OSWORKITEM_PENDING) != 0U)
+	{
+		// already queued, coalesced
+		return OS_SUCESS;
+	}
+
+	if (OSWorkQPush(ptWorkQ, OS_NULL, OS_NULL, 0, ptItem) != OS_SUCESS)
+	{
+		do
+		{
+			uxState = ptItem->uxState;
+		} while (!FitCompareAndSwap(&ptItem->uxState, uxState, uxState & ~OSWORKITEM_PENDING));
+		return OS_ERROR;
+	}
+
+	return OS_SUCESS;
+}
+
+/*****************************************************************************
+Function    : OSWorkQRun
+Description : Run a batch of the queued works in the order of posting. A work item
+              is taken out of the queue before its callback runs, so a post of it
+              from within the callback queues it again.
+Input       : ptWorkQ -- the work queue.
+              uxMaxNum -- max number of works to be run.
+Output      : None
+Return      : number of works run.
+*****************************************************************************/
+uOSBase_t OSWorkQRun(tOSWorkQ_t *ptWorkQ, uOSBase_t uxMaxNum)
+{
+	tOSWorkCell_t tWork;
+	tOSWorkItem_t *ptItem;
+	uOS32_t uxState;
+	uOSBase_t uxNum;
+
+	for (uxNum = 0; uxNum < uxMaxNum; uxNum++)
+	{
+		if (OSWorkQPop(ptWorkQ, &tWork) != OS_SUCESS)
+		{
+			break;
+		}
+
+		ptItem = tWork.ptItem;
+		if (ptItem != OS_NULL)
+		{
+			do
+			{
+				uxState = ptItem->uxState;
+			} while (!FitCompareAndSwap(&ptItem->uxState, uxState, 0));
+			ptItem->pfnCallback(ptItem->pvArg, uxState & ~OSWORKITEM_PENDING);
+		}
+		else
+		{
+			tWork.pfnCallback(tWork.pvArg, tWork.uxValue);
+		}
+	}
+
+	return uxNum;
+}
+
+/*****************************************************************************
+Function    : OSWorkQTask
+Description : The body of a worker task: run the works in batches of
+              OSWORKQ_BATCH_SIZE, and wait with the pfnWait hook when the queue
+              is empty. More than one worker task can serve a work queue, they
+              should be created with the priority OSWorkQGetPriority(ptWorkQ).
+Input       : pvParameter -- the work queue.
+Output      : None
+Return      : None
+*****************************************************************************/
+void OSWorkQTask(void *pvParameter)
+{
+	tOSWorkQ_t *ptWorkQ = (tOSWorkQ_t *)pvParameter;
+
+	for (;;)
+	{
+		if (OSWorkQRun(ptWorkQ, OSWORKQ_BATCH_SIZE) == 0U && ptWorkQ->pfnWait != OS_NULL)
+		{
+			ptWorkQ->pfnWait(ptWorkQ->pvHookArg);
+		}
+	}
+}
+
+#endif //(OS_WORKQ_ON==1)
+
+#ifdef __cplusplus
+}
+#endif
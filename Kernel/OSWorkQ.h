@@ -0,0 +1,120 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+#ifndef __OS_WORKQ_H_
+#define __OS_WORKQ_H_
+
+#include "OSType.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (OS_WORKQ_ON==1)
+
+/** set in tOSWorkItem_t.uxState while the item is queued */
+#define OSWORKITEM_PENDING		( 0x80000000UL )
+
+/** Hook to wake up a worker task or to block it, eg. give/take a semaphore */
+typedef void (*OSWorkQHook_t)( void * );
+
+/** A work item which is posted again and again(eg. by the same interrupt). While it
+ * is queued, more posts of it are coalesced: their values are ORed into uxState and
+ * the callback runs once with all of them. So the value is limited to 31 bits. */
+typedef struct _tOSWorkItem
+{
+	OSCallbackFunction_t pfnCallback;	/** the callback to be run by a worker task */
+	void *pvArg;						/** the first parameter of the callback */
+	volatile uOS32_t uxState;			/** OSWORKITEM_PENDING | values not yet run */
+}tOSWorkItem_t;
+
+/** One slot of the ring. uxSequence tells whether the slot is free for the post
+ * at a position, or filled for the run at it. */
+typedef struct _tOSWorkCell
+{
+	volatile uOS32_t uxSequence;
+	OSCallbackFunction_t pfnCallback;
+	void *pvArg;
+	uOS32_t uxValue;
+	tOSWorkItem_t *ptItem;				/** not OS_NULL for a coalesced item */
+}tOSWorkCell_t;
+
+typedef struct _tOSWorkQ
+{
+	tOSWorkCell_t *ptCells;				/** the ring, its length is a power of 2 */
+	uOS32_t uxMask;						/** length of the ring - 1 */
+	volatile uOS32_t uxPostPos;			/** position of the next post */
+	volatile uOS32_t uxRunPos;			/** position of the next run */
+	uOSBase_t uxPriority;				/** priority of the worker tasks */
+	OSWorkQHook_t pfnWakeup;			/** called when a post starts a batch of works */
+	OSWorkQHook_t pfnWait;				/** called by a worker task when the queue is empty */
+	void *pvHookArg;					/** the parameter of the hooks */
+}tOSWorkQ_t;
+
+uOSStatus_t OSWorkQInit(tOSWorkQ_t *ptWorkQ, tOSWorkCell_t *ptCells, uOS32_t uxLength, uOSBase_t uxPriority);
+#if (OS_STATIC_ALLOCATION_ON==0)
+tOSWorkQ_t *OSWorkQCreate(uOS32_t uxLength, uOSBase_t uxPriority);
+#endif
+void        OSWorkQSetHook(tOSWorkQ_t *ptWorkQ, OSWorkQHook_t pfnWakeup, OSWorkQHook_t pfnWait, void *pvHookArg);
+void        OSWorkItemInit(tOSWorkItem_t *ptItem, OSCallbackFunction_t pfnCallback, void *pvArg);
+uOSStatus_t OSWorkQPost(tOSWorkQ_t *ptWorkQ, OSCallbackFunction_t pfnCallback, void *pvArg, uOS32_t uxValue);
+uOSStatus_t OSWorkQPostItem(tOSWorkQ_t *ptWorkQ, tOSWorkItem_t *ptItem, uOS32_t uxValue);
+uOSBase_t   OSWorkQRun(tOSWorkQ_t *ptWorkQ, uOSBase_t uxMaxNum);
+void        OSWorkQTask(void *pvParameter);
+
+/** The priority the worker tasks of a work queue are to be created with */
+#define OSWorkQGetPriority(ptWorkQ)		((ptWorkQ)->uxPriority)
+
+/** Declare a work queue and its ring of Length cells(a power of 2, at least 2),
+ * reserved at link time. OSWORKQ_INIT() initializes it before use. A wrong Length
+ * fails to compile on the negative size of the check array. */
+#define OSWORKQ_DEFINE(Name, Length)	typedef uOS8_t atOSWorkQCheck_##Name[((Length) < 2 || ((Length) & ((Length) - 1)) != 0) ? -1 : 1]; \
+										static tOSWorkCell_t gatOSWorkCells_##Name[(Length)]; \
+										tOSWorkQ_t Name
+
+#define OSWORKQ_INIT(Name, Priority)	OSWorkQInit(&(Name), gatOSWorkCells_##Name, \
+										(uOS32_t)(sizeof(gatOSWorkCells_##Name)/sizeof(tOSWorkCell_t)), (Priority))
+
+#endif //(OS_WORKQ_ON==1)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__OS_WORKQ_H_
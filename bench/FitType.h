@@ -0,0 +1,74 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+
+#ifndef __FIT_TYPE_H_
+#define __FIT_TYPE_H_
+
+/** Host(x86-64, gcc) stand-in of the port header CPU/KEIL/ARM_CM3/FitType.h for the
+ * benchmarks in bench/, with the 8-byte alignment that pointers need on the host */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef unsigned char           uOS8_t;
+typedef char                    sOS8_t;
+typedef unsigned short          uOS16_t;
+typedef signed short            sOS16_t;
+typedef unsigned int            uOS32_t;
+typedef signed int              sOS32_t;
+typedef unsigned long long      uOS64_t;
+typedef signed long long        sOS64_t;
+
+typedef uOS32_t                 uOSStack_t;
+typedef sOS32_t                 sOSBase_t;
+typedef uOS32_t                 uOSBase_t;
+typedef uOS32_t                 uOSTick_t;
+typedef sOS32_t                 sOSTick_t;      // as wide as uOSTick_t
+typedef unsigned long           uOSAddr_t;      // as wide as a pointer
+
+#define FITSTACK_GROWTH         ( -1 )
+#define FITBYTE_ALIGNMENT       ( 8 )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__FIT_TYPE_H_
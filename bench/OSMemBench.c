@@ -0,0 +1,166 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+/** Host benchmark of OSMemSet(), OSMemCopy() and OSMemMove() against the C
+ * library, for lengths from 16 B to 64 KiB. Build and run from the top of the
+ * repo on the x86-64 host:
+ *
+ *   gcc -O2 -std=gnu99 -no-pie -Ibench -IKernel -ICPU/KEIL/ARM_CM3 \
+ *       bench/OSMemBench.c Kernel/OSMemory.c -o OSMemBench && ./OSMemBench
+ *
+ * Add -DSETOS_USE_MEM_WORD_COPY=1 to measure the word-wide loops instead of the
+ * C library. bench/AIOSPreset.h stands in for the preset of an application. The result
+ * is nanoseconds per call, the best of several runs, for a destination and a
+ * source with the same word offset(aligned) and with different ones(misaligned).
+ * The -ovl columns move an area 8 bytes up inside one buffer, which takes the
+ * backward path of OSMemMove(). */
+#include "AIOS.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_MAX_LEN		( 64U * 1024U )
+#define BENCH_BYTES			( 64UL * 1024UL * 1024UL )
+#define BENCH_RUNS			( 5 )
+
+typedef void *(*BenchSet_t)( void *, int, size_t );
+typedef void *(*BenchCopy_t)( void *, const void *, size_t );
+
+static uOS8_t gauxBenchDst[BENCH_MAX_LEN + 64U];
+static uOS8_t gauxBenchSrc[BENCH_MAX_LEN + 64U];
+
+void OSIntLock(void)
+{
+}
+
+void OSIntUnock(void)
+{
+}
+
+/* the same signatures as the C library, called through volatile pointers so
+ * that neither side is inlined or folded by the compiler */
+static void *BenchOSMemSet(void *pDst, int iValue, size_t uxLen)
+{
+	return OSMemSet(pDst, (uOS8_t)iValue, (uOSBase_t)uxLen);
+}
+
+static void *BenchOSMemCopy(void *pDst, const void *pSrc, size_t uxLen)
+{
+	return OSMemCopy(pDst, pSrc, (uOSBase_t)uxLen);
+}
+
+static void *BenchOSMemMove(void *pDst, const void *pSrc, size_t uxLen)
+{
+	return OSMemMove(pDst, pSrc, (uOSBase_t)uxLen);
+}
+
+static double BenchNow(void)
+{
+	struct timespec tNow;
+
+	clock_gettime(CLOCK_MONOTONIC, &tNow);
+	return (double)tNow.tv_sec * 1e9 + (double)tNow.tv_nsec;
+}
+
+static double BenchSet(BenchSet_t volatile pfnSet, size_t uxLen)
+{
+	unsigned long uxCalls = BENCH_BYTES / uxLen;
+	unsigned long uxIndex;
+	double dBest = 1e30;
+	double dStart;
+	int iRun;
+
+	for (iRun = 0; iRun < BENCH_RUNS; iRun++)
+	{
+		dStart = BenchNow();
+		for (uxIndex = 0; uxIndex < uxCalls; uxIndex++)
+		{
+			pfnSet(gauxBenchDst, (int)uxIndex, uxLen);
+		}
+		dStart = (BenchNow() - dStart) / (double)uxCalls;
+		dBest = (dStart < dBest) ? dStart : dBest;
+	}
+	return dBest;
+}
+
+static double BenchCopy(BenchCopy_t volatile pfnCopy, uOS8_t *puxDst, const uOS8_t *puxSrc, size_t uxLen)
+{
+	unsigned long uxCalls = BENCH_BYTES / uxLen;
+	unsigned long uxIndex;
+	double dBest = 1e30;
+	double dStart;
+	int iRun;
+
+	for (iRun = 0; iRun < BENCH_RUNS; iRun++)
+	{
+		dStart = BenchNow();
+		for (uxIndex = 0; uxIndex < uxCalls; uxIndex++)
+		{
+			pfnCopy(puxDst, puxSrc, uxLen);
+		}
+		dStart = (BenchNow() - dStart) / (double)uxCalls;
+		dBest = (dStart < dBest) ? dStart : dBest;
+	}
+	return dBest;
+}
+
+int main(void)
+{
+	size_t uxLen;
+
+	memset(gauxBenchSrc, 0x5A, sizeof(gauxBenchSrc));
+	printf("%8s %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s\n", "len",
+		   "OSMemSet", "memset", "OSMemCopy", "memcpy", "copy+1", "memcpy+1",
+		   "OSMemMove", "memmove", "move-ovl", "memmove-ovl");
+	for (uxLen = 16U; uxLen <= BENCH_MAX_LEN; uxLen *= 4U)
+	{
+		printf("%8lu %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", (unsigned long)uxLen,
+			   BenchSet(BenchOSMemSet, uxLen), BenchSet(memset, uxLen),
+			   BenchCopy(BenchOSMemCopy, gauxBenchDst, gauxBenchSrc, uxLen),
+			   BenchCopy(memcpy, gauxBenchDst, gauxBenchSrc, uxLen),
+			   BenchCopy(BenchOSMemCopy, gauxBenchDst, gauxBenchSrc + 1U, uxLen),
+			   BenchCopy(memcpy, gauxBenchDst, gauxBenchSrc + 1U, uxLen),
+			   BenchCopy(BenchOSMemMove, gauxBenchDst, gauxBenchSrc + 8U, uxLen),
+			   BenchCopy(memmove, gauxBenchDst, gauxBenchSrc + 8U, uxLen),
+			   BenchCopy(BenchOSMemMove, gauxBenchSrc + 8U, gauxBenchSrc, uxLen),
+			   BenchCopy(memmove, gauxBenchSrc + 8U, gauxBenchSrc, uxLen));
+	}
+
+	return 0;
+}
@@ -0,0 +1,147 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+/** Host benchmark of the std::pmr memory resources of OSMemResource.h against
+ * the default resource of the C++ library(new/delete over malloc), with a vector,
+ * a map and a list. Build and run from the top of the repo on the x86-64 host,
+ * without OSNew.cpp so that the default resource is the one of the C++ library:
+ *
+ *   gcc -O2 -std=gnu99 -c -Ibench -IKernel -ICPU/KEIL/ARM_CM3 \
+ *       Kernel/OSMemory.c Kernel/OSMemArena.c
+ *   g++ -O2 -std=c++17 -no-pie -Ibench -IKernel -ICPU/KEIL/ARM_CM3 \
+ *       bench/OSMemResourceBench.cpp OSMemory.o OSMemArena.o \
+ *       -o OSMemResourceBench && ./OSMemResourceBench
+ *
+ * The result is microseconds per round of BENCH_NODES insertions into a new
+ * container, the best of several runs. The arena is reset after every round. */
+#include "OSMemResource.h"
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <map>
+#include <vector>
+
+#define BENCH_NODES			( 400 )
+#define BENCH_ROUNDS		( 2000 )
+#define BENCH_RUNS			( 5 )
+#define BENCH_CHUNK_SIZE	( 4096 )
+
+extern "C" void OSIntLock(void)
+{
+}
+
+extern "C" void OSIntUnock(void)
+{
+}
+
+/** run the rounds of Fill with a resource, the arena resource is reset after every round */
+template <class Fill>
+static double BenchRun(std::pmr::memory_resource *ptResource, OSMemArenaResource *ptArena, Fill tFill)
+{
+	double dBest = 1e30;
+
+	for (int iRun = 0; iRun < BENCH_RUNS; iRun++)
+	{
+		auto tStart = std::chrono::steady_clock::now();
+		for (int iRound = 0; iRound < BENCH_ROUNDS; iRound++)
+		{
+			tFill(ptResource);
+			if (ptArena != nullptr)
+			{
+				ptArena->Reset();
+			}
+		}
+		std::chrono::duration<double, std::micro> tTime = std::chrono::steady_clock::now() - tStart;
+		double dRound = tTime.count() / BENCH_ROUNDS;
+		dBest = (dRound < dBest) ? dRound : dBest;
+	}
+	return dBest;
+}
+
+static void BenchVector(std::pmr::memory_resource *ptResource)
+{
+	std::pmr::vector<int> tVector(ptResource);
+	for (int iNode = 0; iNode < BENCH_NODES; iNode++)
+	{
+		tVector.push_back(iNode);
+	}
+}
+
+static void BenchMap(std::pmr::memory_resource *ptResource)
+{
+	std::pmr::map<int, int> tMap(ptResource);
+	for (int iNode = 0; iNode < BENCH_NODES; iNode++)
+	{
+		// a scrambled order of keys, so that the tree is rebalanced
+		tMap.emplace((iNode * 7919) % BENCH_NODES, iNode);
+	}
+}
+
+static void BenchList(std::pmr::memory_resource *ptResource)
+{
+	std::pmr::list<int> tList(ptResource);
+	for (int iNode = 0; iNode < BENCH_NODES; iNode++)
+	{
+		tList.push_back(iNode);
+	}
+}
+
+template <class Fill>
+static void BenchContainer(const char *pcName, Fill tFill)
+{
+	double dDefault = BenchRun(std::pmr::new_delete_resource(), nullptr, tFill);
+	double dHeap = BenchRun(OSMemGetHeapResource(), nullptr, tFill);
+	double dArena;
+	{
+		OSMemArenaResource tArena(BENCH_CHUNK_SIZE);
+		dArena = BenchRun(&tArena, &tArena, tFill);
+	}
+
+	std::printf("%-8s %12.2f %12.2f %12.2f\n", pcName, dDefault, dHeap, dArena);
+}
+
+int main()
+{
+	std::printf("%-8s %12s %12s %12s  (us per %d insertions)\n", "", "new_delete", "OSMemHeap", "OSMemArena", BENCH_NODES);
+	BenchContainer("vector", BenchVector);
+	BenchContainer("map", BenchMap);
+	BenchContainer("list", BenchList);
+
+	return 0;
+}
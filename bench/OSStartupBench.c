@@ -0,0 +1,142 @@
+/**********************************************************************************************************
+AIOS(Advanced Input Output System) - An Embedded Real Time Operating System (RTOS)
+Copyright (C) 2012~2017 SenseRate.Com All rights reserved.
+http://www.aios.io -- Documentation, latest information, license and contact details.
+http://www.SenseRate.com -- Commercial support, development, porting, licensing and training services.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met: 
+1. Redistributions of source code must retain the above copyright notice, this list of 
+conditions and the following disclaimer. 
+2. Redistributions in binary form must reproduce the above copyright notice, this list 
+of conditions and the following disclaimer in the documentation and/or other materials 
+provided with the distribution. 
+3. Neither the name of the copyright holder nor the names of its contributors may be used 
+to endorse or promote products derived from this software without specific prior written 
+permission. 
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+
+*----------------------------------------------------------------------------
+* Notice of Export Control Law 
+*----------------------------------------------------------------------------
+* SenseRate AIOS may be subject to applicable export control laws and regulations, which might 
+* include those applicable to SenseRate AIOS of U.S. and the country in which you are located. 
+* Import, export and usage of SenseRate AIOS in any manner by you shall be in compliance with such 
+* applicable export control laws and regulations. 
+*---------------------------------------------------------------------------
+***********************************************************************************************************/
+
+
+/** Host measurement of the start-up cost of the kernel objects, in the static
+ * allocation mode against the dynamic one. Build each mode and run it from the top
+ * of the repo on the x86-64 host:
+ *
+ *   SRC="bench/OSStartupBench.c Kernel/OSWorkQ.c Kernel/OSCoroutine.c Kernel/OSMemArena.c \
+ *        Kernel/OSStack.c Kernel/OSTime.c Kernel/OSProfile.c Kernel/OSMemory.c"
+ *   gcc -O2 -std=gnu99 -no-pie -Ibench -IKernel -ICPU/KEIL/ARM_CM3 $SRC -o OSStartupDyn
+ *   gcc -O2 -std=gnu99 -no-pie -Ibench -IKernel -ICPU/KEIL/ARM_CM3 -DSETOS_STATIC_ALLOCATION=1 \
+ *       $SRC -o OSStartupSta
+ *   ./OSStartupDyn && ./OSStartupSta
+ *
+ * Each binary brings up one work queue, BENCH_COROUTINES coroutines, one arena and
+ * one painted stack, as an application does once at boot, and prints the time stamp
+ * counter cycles it took. The first run is cold, so run each binary a few times and
+ * compare the smallest numbers. The dynamic mode includes the first OSMemMalloc(),
+ * which initializes the heap. */
+#include "AIOS.h"
+#include <stdio.h>
+
+#define BENCH_QUEUE_LENGTH	( 16U )
+#define BENCH_COROUTINES	( 4U )
+#define BENCH_ARENA_SIZE	( 256U )
+#define BENCH_STACK_WORDS	( 128U )
+
+#if (OS_STATIC_ALLOCATION_ON==1)
+OSWORKQ_DEFINE(gtBenchQ, BENCH_QUEUE_LENGTH);
+OSMEMARENA_DEFINE(gtBenchArena, BENCH_ARENA_SIZE);
+static OSCO_DEFINE(gatBenchCo[BENCH_COROUTINES]);
+#endif
+OSSTACK_DEFINE(gtBenchStack, BENCH_STACK_WORDS);
+
+void OSIntLock(void)
+{
+}
+
+void OSIntUnock(void)
+{
+}
+
+static sOSBase_t BenchCoroutine(tOSCoroutine_t *ptCo, void *pvArg)
+{
+	(void)pvArg;
+
+	OSCO_BEGIN(ptCo);
+	OSCO_YIELD(ptCo);
+	OSCO_END(ptCo);
+}
+
+int main(void)
+{
+	uOS64_t uxStart;
+	uOS64_t uxCycles;
+	uOSBase_t uxIndex;
+	uOSBase_t uxRuns = 0;
+	uOSBool_t bOk = OS_TRUE;
+
+	uxStart = __builtin_ia32_rdtsc();
+#if (OS_STATIC_ALLOCATION_ON==1)
+	if (OSWORKQ_INIT(gtBenchQ, 3U) != OS_SUCESS)
+	{
+		bOk = OS_FALSE;
+	}
+	for (uxIndex = 0; uxIndex < BENCH_COROUTINES; uxIndex++)
+	{
+		OSCoStart(&gatBenchCo[uxIndex], BenchCoroutine, OS_NULL, uxIndex + 1U);
+	}
+	if (OSMEMARENA_INIT(gtBenchArena) != OS_SUCESS)
+	{
+		bOk = OS_FALSE;
+	}
+#else
+	if (OSWorkQCreate(BENCH_QUEUE_LENGTH, 3U) == OS_NULL)
+	{
+		bOk = OS_FALSE;
+	}
+	for (uxIndex = 0; uxIndex < BENCH_COROUTINES; uxIndex++)
+	{
+		if (OSCoCreate(BenchCoroutine, OS_NULL, uxIndex + 1U) == OS_NULL)
+		{
+			bOk = OS_FALSE;
+		}
+	}
+	if (OSMemArenaCreate(BENCH_ARENA_SIZE) == OS_NULL)
+	{
+		bOk = OS_FALSE;
+	}
+#endif
+	OSSTACK_PAINT(gtBenchStack, (const sOS8_t *)"bench");
+	uxCycles = __builtin_ia32_rdtsc() - uxStart;
+
+	// the coroutines must run to their end in both modes
+	while (OSCoSchedule(OS_NULL) != 0U)
+	{
+		uxRuns++;
+	}
+
+	printf("%s: %llu cycles, %u schedule passes, %s\n",
+		   (OS_STATIC_ALLOCATION_ON==1) ? "static" : "dynamic",
+		   (unsigned long long)uxCycles, (unsigned)uxRuns, (bOk == OS_TRUE) ? "ok" : "FAILED");
+
+	return (bOk == OS_TRUE) ? 0 : 1;
+}